@@ -0,0 +1,157 @@
+/**
+ * Zenith C++ Backend Microbenchmarks
+ *
+ * Google Benchmark suite for the native backends, measuring them in
+ * isolation from the Rust FFI so backend regressions are attributable.
+ * Covers allocator latency across size classes, thread bind/unbind cost,
+ * first-touch bandwidth, streaming memops, and core ring publish
+ * throughput.
+ *
+ * Build:
+ *   cd ffi-bindings/cpp && mkdir build && cd build
+ *   cmake .. -DBUILD_BENCHMARKS=ON && make
+ *   ./zenith_bench
+ *
+ * Machine-readable output for CI diffing:
+ *   ./zenith_bench --benchmark_format=json > bench.json
+ */
+
+#include "../zenith_core.h"
+#include "../zenith_memops.h"
+#include "../zenith_numa.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+// Initialize NUMA once for the whole run; benchmarks skip themselves when
+// the machine has no NUMA support.
+bool numa_ready() {
+  static bool ready = zenith_numa_init() == ZENITH_NUMA_OK;
+  return ready;
+}
+
+void BM_AllocOnNode(benchmark::State &state) {
+  if (!numa_ready()) {
+    state.SkipWithError("NUMA unavailable");
+    return;
+  }
+  size_t size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    void *ptr = zenith_numa_alloc_onnode(size, 0);
+    benchmark::DoNotOptimize(ptr);
+    zenith_numa_free(ptr, size);
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_AllocOnNode)->Range(4 << 10, 16 << 20);
+
+void BM_AllocOnNodeNoTouch(benchmark::State &state) {
+  if (!numa_ready()) {
+    state.SkipWithError("NUMA unavailable");
+    return;
+  }
+  size_t size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    void *ptr =
+        zenith_numa_alloc_onnode_ex(size, 0, ZENITH_NUMA_ALLOC_NO_TOUCH);
+    benchmark::DoNotOptimize(ptr);
+    zenith_numa_free(ptr, size);
+  }
+}
+BENCHMARK(BM_AllocOnNodeNoTouch)->Range(4 << 10, 16 << 20);
+
+void BM_PoolAllocFree(benchmark::State &state) {
+  if (!numa_ready()) {
+    state.SkipWithError("NUMA unavailable");
+    return;
+  }
+  size_t size = static_cast<size_t>(state.range(0));
+  ZenithNumaPool pool = zenith_numa_pool_create(0, size, 64);
+  if (pool == nullptr) {
+    state.SkipWithError("pool create failed");
+    return;
+  }
+  for (auto _ : state) {
+    void *ptr = zenith_numa_pool_alloc(pool);
+    benchmark::DoNotOptimize(ptr);
+    zenith_numa_pool_free(pool, ptr);
+  }
+  zenith_numa_pool_destroy(pool);
+}
+BENCHMARK(BM_PoolAllocFree)->Range(4 << 10, 2 << 20);
+
+void BM_BindUnbind(benchmark::State &state) {
+  if (!numa_ready()) {
+    state.SkipWithError("NUMA unavailable");
+    return;
+  }
+  for (auto _ : state) {
+    zenith_numa_bind_thread_to_node(0);
+    zenith_numa_unbind_thread();
+  }
+}
+BENCHMARK(BM_BindUnbind);
+
+void BM_FirstTouch(benchmark::State &state) {
+  if (!numa_ready()) {
+    state.SkipWithError("NUMA unavailable");
+    return;
+  }
+  size_t size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    // Allocation + touch together: the touch dominates at these sizes
+    void *ptr = zenith_numa_alloc_onnode(size, 0);
+    benchmark::DoNotOptimize(ptr);
+    zenith_numa_free(ptr, size);
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_FirstTouch)->Arg(64 << 20)->Arg(256 << 20);
+
+void BM_StreamCopy(benchmark::State &state) {
+  size_t size = static_cast<size_t>(state.range(0));
+  std::vector<uint8_t> src(size, 1), dst(size);
+  for (auto _ : state) {
+    zenith_memcpy_stream(dst.data(), src.data(), size);
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+  state.SetLabel(zenith_memops_isa());
+}
+BENCHMARK(BM_StreamCopy)->Range(64 << 10, 16 << 20);
+
+void BM_RingPublish(benchmark::State &state) {
+  ZenithEngine engine = zenith_init(4096);
+  ZenithEvent event = {};
+  for (auto _ : state) {
+    while (zenith_publish(engine, nullptr, nullptr, 0, 0) != ZENITH_OK) {
+      zenith_consume(engine, &event);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  zenith_free(engine);
+}
+BENCHMARK(BM_RingPublish);
+
+void BM_RingPublishBatch(benchmark::State &state) {
+  size_t batch_size = static_cast<size_t>(state.range(0));
+  ZenithEngine engine = zenith_init(8192);
+  std::vector<ZenithEvent> batch(batch_size);
+  ZenithEvent event = {};
+  for (auto _ : state) {
+    int32_t published = zenith_publish_batch(engine, batch.data(), batch_size);
+    for (int32_t i = 0; i < published; i++) {
+      zenith_consume(engine, &event);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+  zenith_free(engine);
+}
+BENCHMARK(BM_RingPublishBatch)->Arg(16)->Arg(256);
+
+} // namespace
+
+BENCHMARK_MAIN();
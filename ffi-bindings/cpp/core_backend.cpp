@@ -0,0 +1,452 @@
+/**
+ * Zenith Core Backend - C++ Implementation
+ *
+ * Native in-process implementation of the engine contract in
+ * zenith_core.h, so low-latency C++ feed handlers can publish directly
+ * instead of bouncing through a separate engine process.
+ *
+ * The event buffer is a bounded lock-free multi-producer ring (sequence-
+ * numbered slots, Vyukov style): producers claim a slot with one
+ * fetch-add, write the event, and release the slot by bumping its
+ * sequence. Head/tail cursors and each slot are cache-line padded to keep
+ * producers from false-sharing under contention. The same ring layout is
+ * reused by the shared-memory transport in core_shm.cpp.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_core.h"
+#include "core_internal.h"
+
+#include <cstring>
+#include <ctime>
+#include <new>
+
+using namespace zenith_core;
+
+namespace {
+
+// Monotonic nanoseconds for the residency histogram (vDSO call, cheap
+// enough to run always-on)
+inline uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull +
+         static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// log2 bucket index, clamped to the histogram width
+inline unsigned latency_bucket(uint64_t ns) {
+  if (ns == 0) {
+    return 0;
+  }
+  unsigned bucket = 63 - static_cast<unsigned>(__builtin_clzll(ns));
+  return bucket < ZENITH_LATENCY_BUCKETS ? bucket
+                                         : ZENITH_LATENCY_BUCKETS - 1;
+}
+
+void record_residency(Engine *engine, uint64_t ns) {
+  engine->lat_counts[latency_bucket(ns)].fetch_add(1,
+                                                   std::memory_order_relaxed);
+  engine->lat_total.fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t seen = engine->lat_min.load(std::memory_order_relaxed);
+  while (ns < seen && !engine->lat_min.compare_exchange_weak(
+                          seen, ns, std::memory_order_relaxed)) {
+  }
+  seen = engine->lat_max.load(std::memory_order_relaxed);
+  while (ns > seen && !engine->lat_max.compare_exchange_weak(
+                          seen, ns, std::memory_order_relaxed)) {
+  }
+}
+
+// Refcount block for ownership-transfer events. The publisher's reference
+// moves into the ring; each consumer gets one from zenith_consume and the
+// release callback fires when the count hits zero.
+struct OwnedPayload {
+  std::atomic<uint32_t> refs;
+  ZenithReleaseFn release;
+  void *user_data;
+  void *array_ptr;
+  void *schema_ptr;
+};
+
+Engine *as_engine(ZenithEngine handle) { return static_cast<Engine *>(handle); }
+
+} // namespace
+
+namespace zenith_core {
+
+int32_t publish_event(Engine *engine, const ZenithEvent &event) {
+  // Sharded engines publish into the node-local ring so head/tail cache
+  // lines never cross a socket on the hot path
+  RingSlot *slots = engine->slots;
+  RingCursors *cursors = engine->cursors;
+  if (!engine->shards.empty()) {
+    size_t idx = local_shard(engine);
+    slots = engine->shards[idx].slots;
+    cursors = engine->shards[idx].cursors;
+  }
+
+  uint64_t pos = cursors->head.load(std::memory_order_relaxed);
+  RingSlot *slot;
+  for (;;) {
+    slot = &slots[pos & engine->mask];
+    uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+    int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+    if (diff == 0) {
+      // Slot is free at our position: claim it
+      if (cursors->head.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Slot still holds an unconsumed event from the previous lap
+      return ZENITH_ERR_BUFFER_FULL;
+    } else {
+      // Another producer claimed this slot; reload and retry
+      pos = cursors->head.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->event = event;
+  slot->publish_ns = now_ns();
+
+  // Release the slot to consumers
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  cursors->events_processed.fetch_add(1, std::memory_order_relaxed);
+  return ZENITH_OK;
+}
+
+} // namespace zenith_core
+
+extern "C" {
+
+ZenithEngine zenith_init(uint32_t buffer_size) {
+  if (buffer_size == 0) {
+    return nullptr;
+  }
+
+  Engine *engine = new (std::nothrow) Engine();
+  if (engine == nullptr) {
+    return nullptr;
+  }
+
+  engine->capacity = next_pow2(buffer_size);
+  engine->mask = engine->capacity - 1;
+  engine->local_slots = new (std::nothrow) RingSlot[engine->capacity];
+  if (engine->local_slots == nullptr) {
+    delete engine;
+    return nullptr;
+  }
+  for (uint64_t i = 0; i < engine->capacity; i++) {
+    engine->local_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  engine->slots = engine->local_slots;
+  engine->cursors = &engine->local_cursors;
+  engine->cursors->head.store(0, std::memory_order_relaxed);
+  engine->cursors->tail.store(0, std::memory_order_relaxed);
+  engine->cursors->events_processed.store(0, std::memory_order_relaxed);
+  return engine;
+}
+
+void zenith_free(ZenithEngine handle) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr) {
+    return;
+  }
+
+  // Drop the ring's reference on any events never consumed. Only the
+  // local engine tracks ownership; shm events carry no process-local
+  // owners.
+  if (engine->map_base == nullptr) {
+    for (size_t i = 0; i < engine->ring_count(); i++) {
+      RingSlot *slots = engine->ring_slots(i);
+      RingCursors *cursors = engine->ring_cursors(i);
+      uint64_t h = cursors->head.load(std::memory_order_acquire);
+      for (uint64_t pos = cursors->tail.load(std::memory_order_acquire);
+           pos != h; pos++) {
+        zenith_event_release(&slots[pos & engine->mask].event);
+      }
+    }
+  }
+
+  delete[] engine->local_slots;
+  zenith_shard_teardown(engine);
+  zenith_shm_teardown(engine);
+  zenith_plugin_cache_teardown(engine);
+  delete engine;
+}
+
+int32_t zenith_publish(ZenithEngine handle, void *array_ptr, void *schema_ptr,
+                       uint32_t source_id, uint64_t seq_no) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  ZenithEvent event;
+  event.array_ptr = array_ptr;
+  event.schema_ptr = schema_ptr;
+  event.source_id = source_id;
+  event.seq_no = seq_no;
+  event.owner = nullptr;
+  return publish_event(engine, event);
+}
+
+int32_t zenith_publish_owned(ZenithEngine handle, void *array_ptr,
+                             void *schema_ptr, uint32_t source_id,
+                             uint64_t seq_no, ZenithReleaseFn release,
+                             void *user_data) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || release == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  OwnedPayload *owner = new (std::nothrow) OwnedPayload();
+  if (owner == nullptr) {
+    return ZENITH_ERR_FFI;
+  }
+  owner->refs.store(1, std::memory_order_relaxed);
+  owner->release = release;
+  owner->user_data = user_data;
+  owner->array_ptr = array_ptr;
+  owner->schema_ptr = schema_ptr;
+
+  ZenithEvent event;
+  event.array_ptr = array_ptr;
+  event.schema_ptr = schema_ptr;
+  event.source_id = source_id;
+  event.seq_no = seq_no;
+  event.owner = owner;
+
+  int32_t rc = publish_event(engine, event);
+  if (rc != ZENITH_OK) {
+    // Ownership did not transfer; the caller keeps its payload
+    delete owner;
+  }
+  return rc;
+}
+
+int32_t zenith_publish_batch(ZenithEngine handle, const ZenithEvent *events,
+                             size_t count) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || events == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+  if (count == 0) {
+    return 0;
+  }
+  if (count > static_cast<size_t>(INT32_MAX)) {
+    count = INT32_MAX;
+  }
+
+  // The whole batch goes into one ring; for sharded engines that is the
+  // publisher's node-local shard
+  RingSlot *slots = engine->slots;
+  RingCursors *cursors = engine->cursors;
+  if (!engine->shards.empty()) {
+    size_t idx = local_shard(engine);
+    slots = engine->shards[idx].slots;
+    cursors = engine->shards[idx].cursors;
+  }
+
+  // Claim a contiguous run of slots with one head update. The tail read
+  // is conservative (consumers only advance it), so every claimed slot is
+  // guaranteed free.
+  uint64_t pos = cursors->head.load(std::memory_order_relaxed);
+  uint64_t claimed;
+  for (;;) {
+    uint64_t tail = cursors->tail.load(std::memory_order_acquire);
+    uint64_t available = engine->capacity - (pos - tail);
+    claimed = count < available ? count : available;
+    if (claimed == 0) {
+      return 0; // ring full: caller applies backpressure
+    }
+    if (cursors->head.compare_exchange_weak(pos, pos + claimed,
+                                            std::memory_order_relaxed)) {
+      break;
+    }
+  }
+
+  uint64_t publish_ns = now_ns(); // one timestamp covers the batch
+  for (uint64_t i = 0; i < claimed; i++) {
+    RingSlot *slot = &slots[(pos + i) & engine->mask];
+    slot->event = events[i];
+    slot->publish_ns = publish_ns;
+    slot->sequence.store(pos + i + 1, std::memory_order_release);
+  }
+
+  cursors->events_processed.fetch_add(claimed, std::memory_order_relaxed);
+  return static_cast<int32_t>(claimed);
+}
+
+void zenith_event_retain(ZenithEvent *event) {
+  if (event == nullptr || event->owner == nullptr) {
+    return;
+  }
+  OwnedPayload *owner = static_cast<OwnedPayload *>(event->owner);
+  owner->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void zenith_event_release(ZenithEvent *event) {
+  if (event == nullptr || event->owner == nullptr) {
+    return;
+  }
+  OwnedPayload *owner = static_cast<OwnedPayload *>(event->owner);
+  if (owner->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    owner->release(owner->array_ptr, owner->schema_ptr, owner->user_data);
+    delete owner;
+  }
+  event->owner = nullptr;
+}
+
+namespace {
+
+// Pop the oldest event from one ring; shared by the single-ring path
+// and the per-shard drain
+int32_t consume_ring(Engine *engine, RingSlot *slots, RingCursors *cursors,
+                     ZenithEvent *out) {
+  uint64_t pos = cursors->tail.load(std::memory_order_relaxed);
+  RingSlot *slot;
+  for (;;) {
+    slot = &slots[pos & engine->mask];
+    uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+    int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+    if (diff == 0) {
+      if (cursors->tail.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return ZENITH_ERR_BUFFER_EMPTY;
+    } else {
+      pos = cursors->tail.load(std::memory_order_relaxed);
+    }
+  }
+
+  *out = slot->event;
+  uint64_t published = slot->publish_ns;
+
+  // Free the slot for the next producer lap
+  slot->sequence.store(pos + engine->capacity, std::memory_order_release);
+
+  uint64_t consumed = now_ns();
+  record_residency(engine, consumed > published ? consumed - published : 0);
+  return ZENITH_OK;
+}
+
+} // namespace
+
+int32_t zenith_consume(ZenithEngine handle, ZenithEvent *out) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || out == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  if (engine->shards.empty()) {
+    return consume_ring(engine, engine->slots, engine->cursors, out);
+  }
+
+  // Drain the consumer's node-local shard first so the common case stays
+  // on-socket, then sweep the remote shards so nothing starves
+  size_t n = engine->shards.size();
+  size_t start = local_shard(engine);
+  for (size_t k = 0; k < n; k++) {
+    size_t idx = (start + k) % n;
+    int32_t rc = consume_ring(engine, engine->shards[idx].slots,
+                              engine->shards[idx].cursors, out);
+    if (rc != ZENITH_ERR_BUFFER_EMPTY) {
+      return rc;
+    }
+  }
+  return ZENITH_ERR_BUFFER_EMPTY;
+}
+
+int32_t zenith_get_latency_histogram(ZenithEngine handle,
+                                     ZenithHistogram *hist) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || hist == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  for (unsigned i = 0; i < ZENITH_LATENCY_BUCKETS; i++) {
+    hist->counts[i] = engine->lat_counts[i].load(std::memory_order_relaxed);
+  }
+  hist->total_events = engine->lat_total.load(std::memory_order_relaxed);
+  uint64_t min = engine->lat_min.load(std::memory_order_relaxed);
+  hist->min_ns = min == UINT64_MAX ? 0 : min;
+  hist->max_ns = engine->lat_max.load(std::memory_order_relaxed);
+  return ZENITH_OK;
+}
+
+int32_t zenith_reset_latency_histogram(ZenithEngine handle) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  for (unsigned i = 0; i < ZENITH_LATENCY_BUCKETS; i++) {
+    engine->lat_counts[i].store(0, std::memory_order_relaxed);
+  }
+  engine->lat_total.store(0, std::memory_order_relaxed);
+  engine->lat_min.store(UINT64_MAX, std::memory_order_relaxed);
+  engine->lat_max.store(0, std::memory_order_relaxed);
+  return ZENITH_OK;
+}
+
+int32_t zenith_load_plugin(ZenithEngine handle, const uint8_t *wasm_bytes,
+                           size_t len) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || wasm_bytes == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  // Minimal validation: WASM magic + version header
+  static const uint8_t kWasmMagic[4] = {0x00, 0x61, 0x73, 0x6d};
+  if (len < 8 || memcmp(wasm_bytes, kWasmMagic, 4) != 0) {
+    return ZENITH_ERR_PLUGIN_LOAD;
+  }
+
+  std::lock_guard<std::mutex> lock(engine->plugin_mutex);
+  engine->plugins.emplace_back(wasm_bytes, wasm_bytes + len);
+  return ZENITH_OK;
+}
+
+int32_t zenith_get_stats(ZenithEngine handle, ZenithStats *stats) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || stats == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  stats->buffer_len = engine->len();
+  {
+    std::lock_guard<std::mutex> lock(engine->plugin_mutex);
+    stats->plugin_count = engine->plugins.size() + engine->plugin_maps.size();
+  }
+  stats->events_processed = 0;
+  for (size_t i = 0; i < engine->ring_count(); i++) {
+    stats->events_processed += engine->ring_cursors(i)->events_processed.load(
+        std::memory_order_relaxed);
+  }
+  return ZENITH_OK;
+}
+
+int32_t zenith_get_status(ZenithEngine handle, ZenithStatus *status) {
+  Engine *engine = as_engine(handle);
+  if (engine == nullptr || status == nullptr) {
+    return ZENITH_ERR_NULL_PTR;
+  }
+
+  status->status = "running";
+  status->buffer_len = engine->len();
+  {
+    std::lock_guard<std::mutex> lock(engine->plugin_mutex);
+    status->plugin_count = engine->plugins.size() + engine->plugin_maps.size();
+  }
+  return ZENITH_OK;
+}
+
+} // extern "C"
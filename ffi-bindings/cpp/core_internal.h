@@ -0,0 +1,150 @@
+/**
+ * Zenith Core Backend - Internal Shared State
+ *
+ * Engine and ring layout shared between the core backend translation
+ * units (local engine in core_backend.cpp, shared-memory transport in
+ * core_shm.cpp). Not installed; FFI consumers must use zenith_core.h.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZENITH_CORE_INTERNAL_H
+#define ZENITH_CORE_INTERNAL_H
+
+#include "../zenith_core.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace zenith_core {
+
+constexpr size_t kCacheLine = 64;
+
+inline uint32_t next_pow2(uint32_t v) {
+  if (v < 2) {
+    return 2;
+  }
+  v--;
+  v |= v >> 1;
+  v |= v >> 2;
+  v |= v >> 4;
+  v |= v >> 8;
+  v |= v >> 16;
+  return v + 1;
+}
+
+// One ring slot: sequence-numbered (Vyukov style) and cache-line padded.
+// Trivial layout with lock-free 64-bit atomics, so the same struct works
+// in-process and inside a shared-memory mapping.
+struct alignas(kCacheLine) RingSlot {
+  std::atomic<uint64_t> sequence;
+  ZenithEvent event;
+  uint64_t publish_ns; // residency clock; ordered by the sequence store
+};
+
+// Cursor block: layout-stable so it can live in shared memory
+struct RingCursors {
+  alignas(kCacheLine) std::atomic<uint64_t> head; // next slot to publish
+  alignas(kCacheLine) std::atomic<uint64_t> tail; // next slot to consume
+  alignas(kCacheLine) std::atomic<uint64_t> events_processed;
+};
+
+// Engine handle. The ring state is always reached through pointers so the
+// slots and cursors can live either in process-local storage or in a
+// shared-memory mapping.
+struct Engine {
+  RingSlot *slots = nullptr;
+  uint64_t capacity = 0; // power of two
+  uint64_t mask = 0;
+  RingCursors *cursors = nullptr;
+
+  // Local-mode backing storage (unused in shm mode)
+  RingSlot *local_slots = nullptr;
+  RingCursors local_cursors;
+
+  // Shared-memory mode
+  void *map_base = nullptr;
+  size_t map_size = 0;
+  bool shm_creator = false;
+  std::string shm_name;
+
+  // Sharded mode (core_shard.cpp): one ring per NUMA node, cursors and
+  // slots living together in a node-local block so producers never
+  // bounce head/tail cache lines across sockets. Empty for single-ring
+  // engines; when populated, the top-level slots/cursors fields are
+  // unused and every path routes through ring_slots/ring_cursors.
+  struct ShardRing {
+    RingSlot *slots;
+    RingCursors *cursors;
+    void *numa_base;   // released with zenith_numa_free
+    size_t numa_bytes;
+  };
+  std::vector<ShardRing> shards;
+
+  size_t ring_count() const { return shards.empty() ? 1 : shards.size(); }
+  RingSlot *ring_slots(size_t i) const {
+    return shards.empty() ? slots : shards[i].slots;
+  }
+  RingCursors *ring_cursors(size_t i) const {
+    return shards.empty() ? cursors : shards[i].cursors;
+  }
+
+  // Plugins are process-local, rare-path state; a mutex is fine here.
+  // Byte-owned modules live in `plugins`; warm cache hits are mmap'd
+  // artifacts tracked in `plugin_maps` and unmapped in zenith_free.
+  std::mutex plugin_mutex;
+  std::vector<std::vector<uint8_t>> plugins;
+  struct PluginMapping {
+    void *base;
+    size_t len;
+  };
+  std::vector<PluginMapping> plugin_maps;
+
+  // Ring residency histogram, recorded on the consume side with relaxed
+  // atomics (lock-free; uncontended with a single consumer). Process-
+  // local even for shm engines: each attachment measures what it
+  // consumes.
+  std::atomic<uint64_t> lat_counts[ZENITH_LATENCY_BUCKETS] = {};
+  std::atomic<uint64_t> lat_total{0};
+  std::atomic<uint64_t> lat_min{UINT64_MAX};
+  std::atomic<uint64_t> lat_max{0};
+
+  uint64_t len() const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < ring_count(); i++) {
+      const RingCursors *c = ring_cursors(i);
+      uint64_t h = c->head.load(std::memory_order_acquire);
+      uint64_t t = c->tail.load(std::memory_order_acquire);
+      total += h - t;
+    }
+    return total;
+  }
+};
+
+// Claim one slot, write the event, and release it to consumers
+// (core_backend.cpp). Shared by every publish path; sharded engines
+// route to the publisher's node-local ring.
+int32_t publish_event(Engine *engine, const ZenithEvent &event);
+
+// Index of the ring local to the calling thread's NUMA node
+// (core_shard.cpp). Always 0 for single-ring engines.
+size_t local_shard(const Engine *engine);
+
+// Free the node-local shard rings, if any (core_shard.cpp). Called from
+// zenith_free; no-op for single-ring engines.
+void zenith_shard_teardown(Engine *engine);
+
+// Release a shared-memory mapping held by the engine, if any
+// (core_shm.cpp). Called from zenith_free; no-op for local engines.
+void zenith_shm_teardown(Engine *engine);
+
+// Unmap cached plugin artifacts (core_plugin_cache.cpp). Called from
+// zenith_free.
+void zenith_plugin_cache_teardown(Engine *engine);
+
+} // namespace zenith_core
+
+#endif // ZENITH_CORE_INTERNAL_H
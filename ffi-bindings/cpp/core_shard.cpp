@@ -0,0 +1,153 @@
+/**
+ * Zenith Core Backend - Per-Node Event Sharding
+ *
+ * A single ring makes every producer bounce the head cursor's cache
+ * line across sockets, which caps publish throughput regardless of ring
+ * size. zenith_init_sharded instead builds one ring per NUMA node, with
+ * cursors and slots living together in node-local memory from
+ * zenith_numa_alloc_onnode. Producers publish into the ring of the node
+ * they are running on (routed by CPU, core_backend.cpp), so the slot
+ * claim touches only local cache lines and publish scales with sockets;
+ * consumers drain their local shard first and sweep the rest so no
+ * shard starves. FIFO ordering holds per shard, not globally.
+ *
+ * When the NUMA backend is absent, uninitialized, or reports a single
+ * node, sharded init degrades to the plain single-ring engine.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_core.h"
+#include "core_internal.h"
+
+#include <new>
+
+#ifdef ZENITH_CORE_HAS_NUMA
+#include "../zenith_numa.h"
+#include <sched.h>
+#endif
+
+using namespace zenith_core;
+
+namespace {
+
+#ifdef ZENITH_CORE_HAS_NUMA
+
+// Per-shard block layout: cursors first, then the cache-line-aligned
+// slot array, mirroring the shm mapping layout
+constexpr size_t shard_slots_offset() {
+  return (sizeof(RingCursors) + kCacheLine - 1) & ~(kCacheLine - 1);
+}
+
+void free_shards(Engine *engine) {
+  for (Engine::ShardRing &shard : engine->shards) {
+    zenith_numa_free(shard.numa_base, shard.numa_bytes);
+  }
+  engine->shards.clear();
+}
+
+#endif // ZENITH_CORE_HAS_NUMA
+
+} // namespace
+
+namespace zenith_core {
+
+size_t local_shard(const Engine *engine) {
+  size_t n = engine->shards.size();
+  if (n <= 1) {
+    return 0;
+  }
+#ifdef ZENITH_CORE_HAS_NUMA
+  int cpu = sched_getcpu();
+  if (cpu >= 0) {
+    int32_t node = zenith_numa_node_of_cpu(cpu);
+    if (node >= 0 && static_cast<size_t>(node) < n) {
+      return static_cast<size_t>(node);
+    }
+  }
+#endif
+  return 0;
+}
+
+void zenith_shard_teardown(Engine *engine) {
+#ifdef ZENITH_CORE_HAS_NUMA
+  if (engine != nullptr) {
+    free_shards(engine);
+  }
+#else
+  (void)engine;
+#endif
+}
+
+} // namespace zenith_core
+
+extern "C" {
+
+#ifdef ZENITH_CORE_HAS_NUMA
+
+ZenithEngine zenith_init_sharded(uint32_t buffer_size, int32_t shard_mode) {
+  if (buffer_size == 0 || shard_mode != ZENITH_SHARD_BY_NODE) {
+    return nullptr;
+  }
+
+  // One node (or NUMA unavailable): the plain ring is already local
+  int32_t nodes = zenith_numa_num_nodes();
+  if (nodes < 2) {
+    return zenith_init(buffer_size);
+  }
+
+  Engine *engine = new (std::nothrow) Engine();
+  if (engine == nullptr) {
+    return nullptr;
+  }
+  engine->capacity = next_pow2(buffer_size);
+  engine->mask = engine->capacity - 1;
+
+  size_t bytes =
+      shard_slots_offset() + engine->capacity * sizeof(RingSlot);
+  for (int32_t node = 0; node < nodes; node++) {
+    void *base = zenith_numa_alloc_onnode(bytes, node);
+    if (base == nullptr) {
+      free_shards(engine);
+      delete engine;
+      return nullptr;
+    }
+
+    RingCursors *cursors = new (base) RingCursors();
+    cursors->head.store(0, std::memory_order_relaxed);
+    cursors->tail.store(0, std::memory_order_relaxed);
+    cursors->events_processed.store(0, std::memory_order_relaxed);
+
+    RingSlot *slots = reinterpret_cast<RingSlot *>(
+        static_cast<uint8_t *>(base) + shard_slots_offset());
+    for (uint64_t i = 0; i < engine->capacity; i++) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+      slots[i].event = ZenithEvent{};
+    }
+
+    engine->shards.push_back({slots, cursors, base, bytes});
+  }
+  return engine;
+}
+
+#else // Fallback: no NUMA backend linked, every node is node 0
+
+ZenithEngine zenith_init_sharded(uint32_t buffer_size, int32_t shard_mode) {
+  if (buffer_size == 0 || shard_mode != ZENITH_SHARD_BY_NODE) {
+    return nullptr;
+  }
+  return zenith_init(buffer_size);
+}
+
+#endif // ZENITH_CORE_HAS_NUMA
+
+size_t zenith_shard_count(ZenithEngine handle) {
+  Engine *engine = static_cast<Engine *>(handle);
+  if (engine == nullptr) {
+    return 0;
+  }
+  return engine->ring_count();
+}
+
+} // extern "C"
@@ -0,0 +1,208 @@
+/**
+ * Zenith Core Backend - Shared-Memory Transport
+ *
+ * Places the zenith_core.h event ring inside a POSIX shared-memory
+ * mapping so co-located producer processes (e.g. Python dataloader
+ * workers) can publish into the engine without a socket hop: the hot
+ * path is the same lock-free slot claim as the in-process ring, with
+ * zero copies and zero syscalls.
+ *
+ * The array/schema pointer fields are transported verbatim; cross-process
+ * producers should pass offsets into a shared payload region rather than
+ * raw process-local addresses. Ownership-transfer (zenith_publish_owned)
+ * is in-process only and must not be used on an shm engine.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_core.h"
+#include "core_internal.h"
+
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#define ZENITH_USE_SHM 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define ZENITH_USE_SHM 0
+#endif
+
+using namespace zenith_core;
+
+namespace {
+
+constexpr uint64_t kShmMagic = 0x5a4e5348'4d303031ull; // "ZNSHM001"
+// v2: RingSlot carries publish_ns for the residency histogram
+constexpr uint32_t kShmVersion = 2;
+
+// Mapping layout: header, then the cache-line-aligned slot array
+struct ShmHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t capacity;
+  RingCursors cursors;
+};
+
+constexpr size_t slots_offset() {
+  return (sizeof(ShmHeader) + kCacheLine - 1) & ~(kCacheLine - 1);
+}
+
+size_t mapping_size(uint64_t capacity) {
+  return slots_offset() + capacity * sizeof(RingSlot);
+}
+
+#if ZENITH_USE_SHM
+
+Engine *wrap_mapping(void *base, size_t size, bool creator,
+                     const char *name) {
+  ShmHeader *header = static_cast<ShmHeader *>(base);
+
+  Engine *engine = new (std::nothrow) Engine();
+  if (engine == nullptr) {
+    munmap(base, size);
+    return nullptr;
+  }
+
+  engine->capacity = header->capacity;
+  engine->mask = header->capacity - 1;
+  engine->slots = reinterpret_cast<RingSlot *>(static_cast<uint8_t *>(base) +
+                                               slots_offset());
+  engine->cursors = &header->cursors;
+  engine->map_base = base;
+  engine->map_size = size;
+  engine->shm_creator = creator;
+  engine->shm_name = name;
+  return engine;
+}
+
+#endif // ZENITH_USE_SHM
+
+} // namespace
+
+namespace zenith_core {
+
+void zenith_shm_teardown(Engine *engine) {
+#if ZENITH_USE_SHM
+  if (engine == nullptr || engine->map_base == nullptr) {
+    return;
+  }
+  munmap(engine->map_base, engine->map_size);
+  if (engine->shm_creator) {
+    shm_unlink(engine->shm_name.c_str());
+  }
+  engine->map_base = nullptr;
+#else
+  (void)engine;
+#endif
+}
+
+} // namespace zenith_core
+
+extern "C" {
+
+#if ZENITH_USE_SHM
+
+ZenithEngine zenith_init_shm(const char *name, uint32_t buffer_size) {
+  if (name == nullptr || buffer_size == 0) {
+    return nullptr;
+  }
+
+  uint64_t capacity = next_pow2(buffer_size);
+  size_t size = mapping_size(capacity);
+
+  int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return nullptr;
+  }
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    close(fd);
+    shm_unlink(name);
+    return nullptr;
+  }
+
+  void *base =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd); // the mapping keeps the object alive
+  if (base == MAP_FAILED) {
+    shm_unlink(name);
+    return nullptr;
+  }
+
+  // Initialize the ring in place. The fresh mapping is zero-filled, so
+  // cursors start at zero; only the slot sequences need seeding.
+  ShmHeader *header = new (base) ShmHeader();
+  header->capacity = capacity;
+  RingSlot *slots = reinterpret_cast<RingSlot *>(
+      static_cast<uint8_t *>(base) + slots_offset());
+  for (uint64_t i = 0; i < capacity; i++) {
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+    slots[i].event = ZenithEvent{};
+  }
+  header->version = kShmVersion;
+  // Publish the header last so attachers never see a half-built ring
+  __atomic_store_n(&header->magic, kShmMagic, __ATOMIC_RELEASE);
+
+  Engine *engine = wrap_mapping(base, size, true, name);
+  if (engine == nullptr) {
+    shm_unlink(name);
+  }
+  return engine;
+}
+
+ZenithEngine zenith_attach_shm(const char *name) {
+  if (name == nullptr) {
+    return nullptr;
+  }
+
+  int fd = shm_open(name, O_RDWR, 0);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(ShmHeader))) {
+    close(fd);
+    return nullptr;
+  }
+
+  size_t size = static_cast<size_t>(st.st_size);
+  void *base =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+
+  ShmHeader *header = static_cast<ShmHeader *>(base);
+  if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != kShmMagic ||
+      header->version != kShmVersion ||
+      size < mapping_size(header->capacity)) {
+    munmap(base, size);
+    return nullptr;
+  }
+
+  return wrap_mapping(base, size, false, name);
+}
+
+#else // Fallback stubs (no POSIX shared memory)
+
+ZenithEngine zenith_init_shm(const char *name, uint32_t buffer_size) {
+  (void)name;
+  (void)buffer_size;
+  return nullptr;
+}
+
+ZenithEngine zenith_attach_shm(const char *name) {
+  (void)name;
+  return nullptr;
+}
+
+#endif // ZENITH_USE_SHM
+
+} // extern "C"
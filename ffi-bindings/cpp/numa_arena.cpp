@@ -0,0 +1,140 @@
+/**
+ * Zenith NUMA Backend - Arena Allocator
+ *
+ * NUMA-local bump-pointer arenas for short-lived variable-size scratch
+ * allocations (decoded rows, tokenizer buffers) that are far too hot for
+ * the syscall-backed zenith_numa_alloc_* path. An arena is owned by one
+ * worker thread by contract, so the hot path is a pointer bump with no
+ * atomics; zenith_arena_reset rewinds the whole arena between batches
+ * without returning chunks to the kernel.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <new>
+#include <vector>
+
+namespace {
+
+constexpr size_t kArenaAlign = 16;
+
+inline size_t round_up(size_t value, size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+struct ArenaChunk {
+  uint8_t *base;
+  size_t size;
+};
+
+struct Arena {
+  int32_t node;      // target node, -1 = local to the allocating thread
+  size_t chunk_size; // default chunk size; oversize requests get their own
+  std::vector<ArenaChunk> chunks;
+  size_t current; // index of the chunk being bumped
+  size_t offset;  // bump offset within the current chunk
+
+  uint8_t *alloc_chunk(size_t size) {
+    // Scratch memory is written immediately by the caller, so skip the
+    // first-touch pass
+    void *ptr =
+        node >= 0
+            ? zenith_numa_alloc_onnode_ex(size, node, ZENITH_NUMA_ALLOC_NO_TOUCH)
+            : zenith_numa_alloc_local_ex(size, ZENITH_NUMA_ALLOC_NO_TOUCH);
+    return static_cast<uint8_t *>(ptr);
+  }
+};
+
+} // namespace
+
+extern "C" {
+
+ZenithArena zenith_arena_create(int32_t node, size_t chunk_size) {
+  if (chunk_size == 0) {
+    return nullptr;
+  }
+
+  Arena *arena = new (std::nothrow) Arena();
+  if (arena == nullptr) {
+    return nullptr;
+  }
+
+  arena->node = node;
+  arena->chunk_size = round_up(chunk_size, kArenaAlign);
+  arena->current = 0;
+  arena->offset = 0;
+
+  uint8_t *base = arena->alloc_chunk(arena->chunk_size);
+  if (base == nullptr) {
+    delete arena;
+    return nullptr;
+  }
+  arena->chunks.push_back(ArenaChunk{base, arena->chunk_size});
+
+  return arena;
+}
+
+void *zenith_arena_alloc(ZenithArena handle, size_t size) {
+  Arena *arena = static_cast<Arena *>(handle);
+  if (arena == nullptr || size == 0) {
+    return nullptr;
+  }
+
+  size = round_up(size, kArenaAlign);
+
+  // Hot path: bump within the current chunk
+  ArenaChunk &chunk = arena->chunks[arena->current];
+  if (arena->offset + size <= chunk.size) {
+    void *ptr = chunk.base + arena->offset;
+    arena->offset += size;
+    return ptr;
+  }
+
+  // Advance through chunks retained by an earlier reset
+  while (arena->current + 1 < arena->chunks.size()) {
+    arena->current++;
+    arena->offset = 0;
+    ArenaChunk &next = arena->chunks[arena->current];
+    if (size <= next.size) {
+      arena->offset = size;
+      return next.base;
+    }
+  }
+
+  // Grow: oversize requests get a dedicated chunk
+  size_t new_size = size > arena->chunk_size ? size : arena->chunk_size;
+  uint8_t *base = arena->alloc_chunk(new_size);
+  if (base == nullptr) {
+    return nullptr;
+  }
+  arena->chunks.push_back(ArenaChunk{base, new_size});
+  arena->current = arena->chunks.size() - 1;
+  arena->offset = size;
+  return base;
+}
+
+void zenith_arena_reset(ZenithArena handle) {
+  Arena *arena = static_cast<Arena *>(handle);
+  if (arena == nullptr) {
+    return;
+  }
+  arena->current = 0;
+  arena->offset = 0;
+}
+
+void zenith_arena_destroy(ZenithArena handle) {
+  Arena *arena = static_cast<Arena *>(handle);
+  if (arena == nullptr) {
+    return;
+  }
+  for (const ArenaChunk &chunk : arena->chunks) {
+    zenith_numa_free(chunk.base, chunk.size);
+  }
+  delete arena;
+}
+
+} // extern "C"
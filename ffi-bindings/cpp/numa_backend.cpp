@@ -15,26 +15,103 @@
  */
 
 #include "../zenith_numa.h"
+#include "numa_internal.h"
 #include <cstdlib>
 #include <cstring>
 
-// Check if libnuma is available - define ZENITH_HAS_LIBNUMA when building with
-// libnuma CMake will define this automatically when libnuma is found
-#if defined(ZENITH_HAS_LIBNUMA) && defined(__linux__)
-#define ZENITH_USE_LIBNUMA 1
+#if ZENITH_USE_LIBNUMA
 #include <numa.h>
 #include <numaif.h>
 #include <pthread.h>
 #include <sched.h>
-#else
-#define ZENITH_USE_LIBNUMA 0
+#include <sys/mman.h>
 #endif
 
-// Track initialization state
-static bool g_numa_initialized = false;
+// Track initialization state (shared with the other backend TUs)
+bool g_numa_initialized = false;
 
 #if ZENITH_USE_LIBNUMA
 
+#include <ctime>
+
+// Monotonic nanoseconds for the stats latency histograms
+static inline uint64_t zenith_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull +
+         static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// Node the calling thread is currently running on, for attributing local
+// and interleaved allocations
+static inline int32_t zenith_current_node(void) {
+  int cpu = sched_getcpu();
+  return cpu >= 0 ? numa_node_of_cpu(cpu) : 0;
+}
+
+// Nodemasks and per-node CPU sets cached at init so thread binding and
+// policy changes never pay the numa_allocate_nodemask/numa_free_nodemask
+// heap pair on the hot path
+static struct bitmask *g_node_masks[64];
+static struct bitmask *g_all_nodes_mask = nullptr;
+static cpu_set_t g_node_cpusets[64];
+static int g_cached_nodes = 0;
+
+static void zenith_numa_build_mask_cache(void) {
+  int num_nodes = numa_num_configured_nodes();
+  if (num_nodes > 64) {
+    num_nodes = 64;
+  }
+
+  g_all_nodes_mask = numa_allocate_nodemask();
+  struct bitmask *cpumask = numa_allocate_cpumask();
+  for (int node = 0; node < num_nodes; node++) {
+    g_node_masks[node] = numa_allocate_nodemask();
+    if (g_node_masks[node] != nullptr) {
+      numa_bitmask_setbit(g_node_masks[node], node);
+    }
+    if (g_all_nodes_mask != nullptr) {
+      numa_bitmask_setbit(g_all_nodes_mask, node);
+    }
+
+    CPU_ZERO(&g_node_cpusets[node]);
+    if (cpumask != nullptr && numa_node_to_cpus(node, cpumask) == 0) {
+      for (int cpu = 0; cpu < numa_num_configured_cpus(); cpu++) {
+        if (numa_bitmask_isbitset(cpumask, cpu)) {
+          CPU_SET(cpu, &g_node_cpusets[node]);
+        }
+      }
+    }
+  }
+  if (cpumask != nullptr) {
+    numa_free_cpumask(cpumask);
+  }
+  g_cached_nodes = num_nodes;
+}
+
+static void zenith_numa_free_mask_cache(void) {
+  for (int node = 0; node < g_cached_nodes; node++) {
+    if (g_node_masks[node] != nullptr) {
+      numa_free_nodemask(g_node_masks[node]);
+      g_node_masks[node] = nullptr;
+    }
+  }
+  if (g_all_nodes_mask != nullptr) {
+    numa_free_nodemask(g_all_nodes_mask);
+    g_all_nodes_mask = nullptr;
+  }
+  g_cached_nodes = 0;
+}
+
+// Reusable per-thread scratch mask for arbitrary caller-supplied masks
+static struct bitmask *zenith_numa_scratch_mask(void) {
+  thread_local struct bitmask *scratch = numa_allocate_nodemask();
+  if (scratch != nullptr) {
+    numa_bitmask_clearall(scratch);
+  }
+  return scratch;
+}
+
 extern "C" {
 
 /* ============================================================================
@@ -51,11 +128,27 @@ int32_t zenith_numa_init(void) {
     return ZENITH_NUMA_ERR_UNAVAILABLE;
   }
 
+  // Snapshot the machine topology once so later queries are a memcpy
+  zenith_numa_topology_build();
+
+  // Pin the SIMD memory-ops kernels to the host CPU's best ISA
+  zenith_memops_select();
+
+  // Precompute nodemasks and per-node CPU sets for allocation-free binds
+  zenith_numa_build_mask_cache();
+
   g_numa_initialized = true;
   return ZENITH_NUMA_OK;
 }
 
-void zenith_numa_cleanup(void) { g_numa_initialized = false; }
+void zenith_numa_cleanup(void) {
+  zenith_tier_stop();
+  zenith_numa_monitor_shutdown();
+  zenith_numa_prewarm_shutdown();
+  zenith_numa_recycle_shutdown();
+  zenith_numa_free_mask_cache();
+  g_numa_initialized = false;
+}
 
 int32_t zenith_numa_available(void) { return numa_available() >= 0 ? 1 : 0; }
 
@@ -97,7 +190,7 @@ int32_t zenith_numa_preferred_node(void) {
  * ============================================================================
  */
 
-void *zenith_numa_alloc_onnode(size_t size, int32_t node) {
+void *zenith_numa_alloc_onnode_ex(size_t size, int32_t node, uint32_t flags) {
   if (!g_numa_initialized) {
     return nullptr;
   }
@@ -106,46 +199,143 @@ void *zenith_numa_alloc_onnode(size_t size, int32_t node) {
     return nullptr;
   }
 
-  void *ptr = numa_alloc_onnode(size, node);
-  if (ptr != nullptr) {
+  uint64_t start = zenith_now_ns();
+  // Recycled buffers skip the numa_alloc_onnode mmap entirely
+  void *ptr = zenith_numa_recycle_acquire(size, node);
+  if (ptr == nullptr) {
+    ptr = numa_alloc_onnode(size, node);
+  }
+  if (ptr != nullptr && !(flags & ZENITH_NUMA_ALLOC_NO_TOUCH)) {
     // Touch the memory to ensure it's actually allocated on the node
-    // (first-touch policy)
-    memset(ptr, 0, size);
+    // (first-touch policy); large buffers are touched by a thread team
+    // pinned to the node
+    zenith_numa_first_touch(ptr, size, node);
+  }
+  if (ptr != nullptr) {
+    zenith_numa_stats_record_alloc(node, size, zenith_now_ns() - start);
   }
 
   return ptr;
 }
 
-void *zenith_numa_alloc_interleaved(size_t size) {
+void *zenith_numa_alloc_onnode(size_t size, int32_t node) {
+  return zenith_numa_alloc_onnode_ex(size, node, 0);
+}
+
+void *zenith_numa_alloc_interleaved_ex(size_t size, uint32_t flags) {
   if (!g_numa_initialized) {
     return nullptr;
   }
 
+  uint64_t start = zenith_now_ns();
   void *ptr = numa_alloc_interleaved(size);
+  if (ptr != nullptr && !(flags & ZENITH_NUMA_ALLOC_NO_TOUCH)) {
+    // Unpinned team: interleaved pages should fault from many CPUs
+    zenith_numa_first_touch(ptr, size, -1);
+  }
   if (ptr != nullptr) {
-    memset(ptr, 0, size);
+    zenith_numa_stats_record_alloc(zenith_current_node(), size,
+                                   zenith_now_ns() - start);
   }
 
   return ptr;
 }
 
-void *zenith_numa_alloc_local(size_t size) {
+void *zenith_numa_alloc_interleaved(size_t size) {
+  return zenith_numa_alloc_interleaved_ex(size, 0);
+}
+
+void *zenith_numa_alloc_local_ex(size_t size, uint32_t flags) {
   if (!g_numa_initialized) {
     return nullptr;
   }
 
+  uint64_t start = zenith_now_ns();
   void *ptr = numa_alloc_local(size);
+  if (ptr != nullptr && !(flags & ZENITH_NUMA_ALLOC_NO_TOUCH)) {
+    zenith_numa_first_touch(ptr, size, -1);
+  }
   if (ptr != nullptr) {
-    memset(ptr, 0, size);
+    zenith_numa_stats_record_alloc(zenith_current_node(), size,
+                                   zenith_now_ns() - start);
   }
 
   return ptr;
 }
 
+void *zenith_numa_alloc_local(size_t size) {
+  return zenith_numa_alloc_local_ex(size, 0);
+}
+
+void *zenith_numa_realloc(void *ptr, size_t old_size, size_t new_size) {
+  if (!g_numa_initialized || ptr == nullptr || old_size == 0 ||
+      new_size == 0) {
+    return nullptr;
+  }
+  if (new_size == old_size) {
+    return ptr;
+  }
+
+  // Node of the existing pages, for touching the new tail and for the
+  // fallback allocation
+  int node = -1;
+  get_mempolicy(&node, nullptr, 0, ptr, MPOL_F_NODE | MPOL_F_ADDR);
+
+  uint64_t start = zenith_now_ns();
+  void *remapped = mremap(ptr, old_size, new_size, MREMAP_MAYMOVE);
+  if (remapped != MAP_FAILED) {
+    if (new_size > old_size) {
+      // The vma's policy carries over; fault the tail in on the node
+      zenith_numa_first_touch(static_cast<uint8_t *>(remapped) + old_size,
+                              new_size - old_size, node);
+      zenith_numa_stats_record_alloc(node >= 0 ? node : zenith_current_node(),
+                                     new_size - old_size,
+                                     zenith_now_ns() - start);
+    }
+    return remapped;
+  }
+
+  // Kernel could not remap: allocate-copy-free on the same node
+  void *fresh = node >= 0
+                    ? zenith_numa_alloc_onnode_ex(new_size, node,
+                                                  ZENITH_NUMA_ALLOC_NO_TOUCH)
+                    : zenith_numa_alloc_local_ex(new_size,
+                                                 ZENITH_NUMA_ALLOC_NO_TOUCH);
+  if (fresh == nullptr) {
+    return nullptr;
+  }
+  size_t keep = old_size < new_size ? old_size : new_size;
+  memcpy(fresh, ptr, keep);
+  if (new_size > keep) {
+    zenith_numa_first_touch(static_cast<uint8_t *>(fresh) + keep,
+                            new_size - keep, node);
+  }
+  zenith_numa_free(ptr, old_size);
+  return fresh;
+}
+
 void zenith_numa_free(void *ptr, size_t size) {
-  if (ptr != nullptr && size > 0) {
+  if (ptr == nullptr || size == 0) {
+    return;
+  }
+  uint64_t start = zenith_now_ns();
+  if (zenith_numa_huge_free(ptr)) {
+    zenith_numa_stats_record_free(size, zenith_now_ns() - start);
+    return; // huge-page mapping, released via munmap
+  }
+  if (zenith_numa_pinned_unpin(ptr)) {
+    // Unpinned in place; release immediately rather than caching pages
+    // that were just mlock'd for DMA
     numa_free(ptr, size);
+    zenith_numa_stats_record_free(size, zenith_now_ns() - start);
+    return;
+  }
+  if (zenith_numa_recycle_release(ptr, size)) {
+    zenith_numa_stats_record_free(size, zenith_now_ns() - start);
+    return; // parked on the recycle cache for reuse
   }
+  numa_free(ptr, size);
+  zenith_numa_stats_record_free(size, zenith_now_ns() - start);
 }
 
 /* ============================================================================
@@ -162,15 +352,15 @@ int32_t zenith_numa_bind_thread_to_node(int32_t node) {
     return ZENITH_NUMA_ERR_INVALID_NODE;
   }
 
-  struct bitmask *nodemask = numa_allocate_nodemask();
+  struct bitmask *nodemask =
+      node < g_cached_nodes ? g_node_masks[node] : nullptr;
   if (nodemask == nullptr) {
     return ZENITH_NUMA_ERR_ALLOC_FAILED;
   }
 
-  numa_bitmask_setbit(nodemask, node);
   int result = numa_run_on_node_mask(nodemask);
-  numa_free_nodemask(nodemask);
 
+  zenith_numa_stats_record_bind();
   return result == 0 ? ZENITH_NUMA_OK : ZENITH_NUMA_ERR_BIND_FAILED;
 }
 
@@ -188,6 +378,7 @@ int32_t zenith_numa_bind_thread_to_cpu(int32_t cpu) {
   CPU_SET(cpu, &cpuset);
 
   int result = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+  zenith_numa_stats_record_bind();
   return result == 0 ? ZENITH_NUMA_OK : ZENITH_NUMA_ERR_BIND_FAILED;
 }
 
@@ -196,21 +387,52 @@ int32_t zenith_numa_unbind_thread(void) {
     return ZENITH_NUMA_ERR_UNAVAILABLE;
   }
 
-  // Reset to all nodes
-  struct bitmask *all_nodes = numa_allocate_nodemask();
-  if (all_nodes == nullptr) {
+  // Reset to all nodes via the cached mask
+  if (g_all_nodes_mask == nullptr) {
     return ZENITH_NUMA_ERR_ALLOC_FAILED;
   }
 
-  // Set all bits for all configured nodes
-  for (int i = 0; i < numa_num_configured_nodes(); i++) {
-    numa_bitmask_setbit(all_nodes, i);
+  numa_run_on_node_mask(g_all_nodes_mask);
+
+  return ZENITH_NUMA_OK;
+}
+
+int32_t zenith_numa_apply_bind_plan(const ZenithBindEntry *plan, size_t n) {
+  if (plan == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  if (!g_numa_initialized) {
+    return ZENITH_NUMA_ERR_UNAVAILABLE;
   }
 
-  numa_run_on_node_mask(all_nodes);
-  numa_free_nodemask(all_nodes);
+  int32_t applied = 0;
+  for (size_t i = 0; i < n; i++) {
+    const ZenithBindEntry *entry = &plan[i];
+    pthread_t target = entry->tid != 0
+                           ? static_cast<pthread_t>(entry->tid)
+                           : pthread_self();
+
+    cpu_set_t cpuset;
+    if (entry->cpu >= 0) {
+      if (entry->cpu >= numa_num_configured_cpus()) {
+        continue;
+      }
+      CPU_ZERO(&cpuset);
+      CPU_SET(entry->cpu, &cpuset);
+    } else {
+      if (entry->node < 0 || entry->node >= g_cached_nodes) {
+        continue;
+      }
+      cpuset = g_node_cpusets[entry->node];
+    }
 
-  return ZENITH_NUMA_OK;
+    if (pthread_setaffinity_np(target, sizeof(cpuset), &cpuset) == 0) {
+      applied++;
+    }
+    zenith_numa_stats_record_bind();
+  }
+
+  return applied;
 }
 
 /* ============================================================================
@@ -232,7 +454,7 @@ int32_t zenith_numa_set_interleave(uint64_t nodemask) {
     return ZENITH_NUMA_ERR_UNAVAILABLE;
   }
 
-  struct bitmask *mask = numa_allocate_nodemask();
+  struct bitmask *mask = zenith_numa_scratch_mask();
   if (mask == nullptr) {
     return ZENITH_NUMA_ERR_ALLOC_FAILED;
   }
@@ -245,7 +467,6 @@ int32_t zenith_numa_set_interleave(uint64_t nodemask) {
   }
 
   numa_set_interleave_mask(mask);
-  numa_free_nodemask(mask);
 
   return ZENITH_NUMA_OK;
 }
@@ -255,7 +476,7 @@ int32_t zenith_numa_set_membind(uint64_t nodemask) {
     return ZENITH_NUMA_ERR_UNAVAILABLE;
   }
 
-  struct bitmask *mask = numa_allocate_nodemask();
+  struct bitmask *mask = zenith_numa_scratch_mask();
   if (mask == nullptr) {
     return ZENITH_NUMA_ERR_ALLOC_FAILED;
   }
@@ -268,7 +489,6 @@ int32_t zenith_numa_set_membind(uint64_t nodemask) {
   }
 
   numa_set_membind(mask);
-  numa_free_nodemask(mask);
 
   return ZENITH_NUMA_OK;
 }
@@ -332,7 +552,7 @@ extern "C" {
 
 int32_t zenith_numa_init(void) { return ZENITH_NUMA_ERR_UNAVAILABLE; }
 
-void zenith_numa_cleanup(void) {}
+void zenith_numa_cleanup(void) { zenith_numa_prewarm_shutdown(); }
 
 int32_t zenith_numa_available(void) { return 0; }
 
@@ -347,17 +567,43 @@ int32_t zenith_numa_node_of_cpu(int32_t cpu) {
 
 int32_t zenith_numa_preferred_node(void) { return 0; }
 
+void *zenith_numa_alloc_onnode_ex(size_t size, int32_t node, uint32_t flags) {
+  (void)node;
+  (void)flags;
+  return malloc(size);
+}
+
 void *zenith_numa_alloc_onnode(size_t size, int32_t node) {
   (void)node;
   return malloc(size);
 }
 
+void *zenith_numa_alloc_interleaved_ex(size_t size, uint32_t flags) {
+  (void)flags;
+  return malloc(size);
+}
+
 void *zenith_numa_alloc_interleaved(size_t size) { return malloc(size); }
 
+void *zenith_numa_alloc_local_ex(size_t size, uint32_t flags) {
+  (void)flags;
+  return malloc(size);
+}
+
 void *zenith_numa_alloc_local(size_t size) { return malloc(size); }
 
+void *zenith_numa_realloc(void *ptr, size_t old_size, size_t new_size) {
+  (void)old_size;
+  if (ptr == nullptr || new_size == 0) {
+    return nullptr;
+  }
+  return realloc(ptr, new_size);
+}
+
 void zenith_numa_free(void *ptr, size_t size) {
   (void)size;
+  zenith_numa_huge_free(ptr);
+  zenith_numa_pinned_unpin(ptr);
   free(ptr);
 }
 
@@ -373,6 +619,14 @@ int32_t zenith_numa_bind_thread_to_cpu(int32_t cpu) {
 
 int32_t zenith_numa_unbind_thread(void) { return ZENITH_NUMA_OK; }
 
+int32_t zenith_numa_apply_bind_plan(const ZenithBindEntry *plan, size_t n) {
+  (void)n;
+  if (plan == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
 int32_t zenith_numa_set_preferred(int32_t node) {
   (void)node;
   return ZENITH_NUMA_ERR_UNAVAILABLE;
@@ -0,0 +1,114 @@
+/**
+ * Zenith NUMA Backend - Batched Allocation
+ *
+ * Batch variants of the node-bound allocator that hand out a whole set of
+ * equally-sized buffers in one FFI crossing. The buffers are carved out of
+ * a single contiguous node-bound slab, so the kernel-side mmap+mbind cost
+ * is paid once per batch rather than once per buffer. A slab is returned
+ * to the kernel when the last buffer carved from it is freed, and
+ * zenith_numa_free_batch transparently handles buffers that were not
+ * batch-allocated.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <map>
+#include <mutex>
+
+namespace {
+
+constexpr size_t kCacheLine = 64;
+
+inline size_t round_up(size_t value, size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+struct BatchSlab {
+  size_t slab_size;   // total bytes handed to zenith_numa_free on release
+  size_t slot_size;   // per-buffer stride within the slab
+  uint32_t outstanding; // buffers not yet returned
+};
+
+// Slabs keyed by base address; protected by g_batch_mutex. Lookup by
+// arbitrary buffer pointer uses upper_bound on the base address.
+std::mutex g_batch_mutex;
+std::map<uint8_t *, BatchSlab> g_batch_slabs;
+
+} // namespace
+
+extern "C" {
+
+int32_t zenith_numa_alloc_batch(size_t size, int32_t node, uint32_t count,
+                                void **out) {
+  if (out == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  if (size == 0 || count == 0) {
+    return ZENITH_NUMA_ERR_ALLOC_FAILED;
+  }
+
+  size_t slot_size = round_up(size, kCacheLine);
+  size_t slab_size = slot_size * count;
+
+  uint8_t *slab =
+      static_cast<uint8_t *>(zenith_numa_alloc_onnode(slab_size, node));
+  if (slab == nullptr) {
+    return ZENITH_NUMA_ERR_ALLOC_FAILED;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    out[i] = slab + i * slot_size;
+  }
+
+  std::lock_guard<std::mutex> lock(g_batch_mutex);
+  g_batch_slabs[slab] = BatchSlab{slab_size, slot_size, count};
+  return ZENITH_NUMA_OK;
+}
+
+int32_t zenith_numa_free_batch(void **ptrs, size_t size, uint32_t count) {
+  if (ptrs == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t *ptr = static_cast<uint8_t *>(ptrs[i]);
+    if (ptr == nullptr) {
+      continue;
+    }
+
+    uint8_t *release_base = nullptr;
+    size_t release_size = 0;
+    bool from_slab = false;
+    {
+      std::lock_guard<std::mutex> lock(g_batch_mutex);
+      // Find the slab whose base is at or below ptr
+      auto it = g_batch_slabs.upper_bound(ptr);
+      if (it != g_batch_slabs.begin()) {
+        --it;
+        if (ptr < it->first + it->second.slab_size) {
+          from_slab = true;
+          if (--it->second.outstanding == 0) {
+            release_base = it->first;
+            release_size = it->second.slab_size;
+            g_batch_slabs.erase(it);
+          }
+        }
+      }
+    }
+
+    if (release_base != nullptr) {
+      zenith_numa_free(release_base, release_size);
+    } else if (!from_slab) {
+      // Not batch-allocated: fall through to the regular free path
+      zenith_numa_free(ptr, size);
+    }
+  }
+
+  return ZENITH_NUMA_OK;
+}
+
+} // extern "C"
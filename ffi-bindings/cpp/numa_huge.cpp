@@ -0,0 +1,204 @@
+/**
+ * Zenith NUMA Backend - Huge Page Allocation
+ *
+ * Node-bound allocations backed by 2 MB or 1 GB huge pages to cut dTLB
+ * misses when walking multi-GB staging buffers. Tries explicit hugetlb
+ * mappings first (MAP_HUGETLB), degrades 1 GB requests to 2 MB, then falls
+ * back to transparent huge pages (MADV_HUGEPAGE) and finally base pages.
+ * Every mapping is recorded so zenith_numa_free can route it to munmap and
+ * zenith_numa_get_page_size can report what was actually obtained.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#if ZENITH_USE_LIBNUMA
+#include <numa.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+#endif // ZENITH_USE_LIBNUMA
+
+namespace {
+
+struct HugeAlloc {
+  size_t mapped_size; // size passed to mmap (page-size multiple)
+  size_t page_size;   // page size actually obtained
+};
+
+std::mutex g_huge_mutex;
+std::unordered_map<void *, HugeAlloc> g_huge_allocs;
+
+void register_huge(void *ptr, size_t mapped_size, size_t page_size) {
+  std::lock_guard<std::mutex> lock(g_huge_mutex);
+  g_huge_allocs[ptr] = HugeAlloc{mapped_size, page_size};
+}
+
+} // namespace
+
+#if ZENITH_USE_LIBNUMA
+
+namespace {
+
+size_t round_up(size_t value, size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+// Map `size` bytes backed by explicit hugetlb pages of `page_size`, or
+// fall back to a THP-advised base mapping. Reports the page size the
+// mapping is guaranteed to use (base page size on the THP path, since the
+// kernel promotes those pages opportunistically).
+void *map_with_huge_pages(size_t size, size_t page_size, size_t *mapped_size,
+                          size_t *got_page_size) {
+  const int base_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+  const int prot = PROT_READ | PROT_WRITE;
+
+  if (page_size == ZENITH_NUMA_PAGE_1GB) {
+    size_t rounded = round_up(size, ZENITH_NUMA_PAGE_1GB);
+    void *ptr = mmap(nullptr, rounded, prot,
+                     base_flags | MAP_HUGETLB | MAP_HUGE_1GB, -1, 0);
+    if (ptr != MAP_FAILED) {
+      *mapped_size = rounded;
+      *got_page_size = ZENITH_NUMA_PAGE_1GB;
+      return ptr;
+    }
+    // No 1 GB pages available: degrade to 2 MB
+    page_size = ZENITH_NUMA_PAGE_2MB;
+  }
+
+  if (page_size == ZENITH_NUMA_PAGE_2MB) {
+    size_t rounded = round_up(size, ZENITH_NUMA_PAGE_2MB);
+    void *ptr = mmap(nullptr, rounded, prot,
+                     base_flags | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+    if (ptr != MAP_FAILED) {
+      *mapped_size = rounded;
+      *got_page_size = ZENITH_NUMA_PAGE_2MB;
+      return ptr;
+    }
+  }
+
+  // Fallback: base pages with a THP hint. Align the length to 2 MB so the
+  // kernel can promote whole regions.
+  size_t rounded = round_up(size, ZENITH_NUMA_PAGE_2MB);
+  void *ptr = mmap(nullptr, rounded, prot, base_flags, -1, 0);
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+  madvise(ptr, rounded, MADV_HUGEPAGE);
+  *mapped_size = rounded;
+  *got_page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return ptr;
+}
+
+} // namespace
+
+extern "C" {
+
+void *zenith_numa_alloc_onnode_huge(size_t size, int32_t node,
+                                    size_t page_size) {
+  if (!g_numa_initialized || size == 0) {
+    return nullptr;
+  }
+
+  if (node < 0 || node >= numa_num_configured_nodes()) {
+    return nullptr;
+  }
+
+  if (page_size != ZENITH_NUMA_PAGE_2MB && page_size != ZENITH_NUMA_PAGE_1GB) {
+    return nullptr;
+  }
+
+  size_t mapped_size = 0;
+  size_t got_page_size = 0;
+  void *ptr = map_with_huge_pages(size, page_size, &mapped_size,
+                                  &got_page_size);
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+
+  numa_tonode_memory(ptr, mapped_size, node);
+  zenith_numa_first_touch(ptr, mapped_size, node);
+
+  register_huge(ptr, mapped_size, got_page_size);
+  return ptr;
+}
+
+size_t zenith_numa_get_page_size(const void *ptr) {
+  if (ptr == nullptr) {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(g_huge_mutex);
+  auto it = g_huge_allocs.find(const_cast<void *>(ptr));
+  if (it != g_huge_allocs.end()) {
+    return it->second.page_size;
+  }
+  // Regular zenith_numa_alloc_* allocations use base pages
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+} // extern "C"
+
+// Called from zenith_numa_free: huge mappings must go through munmap, not
+// numa_free. Returns true when `ptr` was a huge allocation and was released.
+bool zenith_numa_huge_free(void *ptr) {
+  std::unique_lock<std::mutex> lock(g_huge_mutex);
+  auto it = g_huge_allocs.find(ptr);
+  if (it == g_huge_allocs.end()) {
+    return false;
+  }
+  size_t mapped_size = it->second.mapped_size;
+  g_huge_allocs.erase(it);
+  lock.unlock();
+
+  munmap(ptr, mapped_size);
+  return true;
+}
+
+#else // Fallback stubs (no libnuma available)
+
+extern "C" {
+
+void *zenith_numa_alloc_onnode_huge(size_t size, int32_t node,
+                                    size_t page_size) {
+  (void)node;
+  if (size == 0 ||
+      (page_size != ZENITH_NUMA_PAGE_2MB && page_size != ZENITH_NUMA_PAGE_1GB)) {
+    return nullptr;
+  }
+  void *ptr = malloc(size);
+  if (ptr != nullptr) {
+    register_huge(ptr, size, 4096);
+  }
+  return ptr;
+}
+
+size_t zenith_numa_get_page_size(const void *ptr) {
+  return ptr == nullptr ? 0 : 4096;
+}
+
+} // extern "C"
+
+bool zenith_numa_huge_free(void *ptr) {
+  std::lock_guard<std::mutex> lock(g_huge_mutex);
+  g_huge_allocs.erase(ptr);
+  return false; // fallback allocations came from malloc; free() handles them
+}
+
+#endif // ZENITH_USE_LIBNUMA
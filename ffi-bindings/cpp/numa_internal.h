@@ -0,0 +1,80 @@
+/**
+ * Zenith NUMA Backend - Internal Shared State
+ *
+ * Shared declarations for the C++ NUMA backend translation units.
+ * Not installed; FFI consumers must use zenith_numa.h only.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZENITH_NUMA_INTERNAL_H
+#define ZENITH_NUMA_INTERNAL_H
+
+// Check if libnuma is available - define ZENITH_HAS_LIBNUMA when building with
+// libnuma CMake will define this automatically when libnuma is found
+#if defined(ZENITH_HAS_LIBNUMA) && defined(__linux__)
+#define ZENITH_USE_LIBNUMA 1
+#else
+#define ZENITH_USE_LIBNUMA 0
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Initialization state, owned by numa_backend.cpp
+extern bool g_numa_initialized;
+
+// Parallel first-touch engine (numa_touch.cpp). Zeroes the buffer with a
+// thread team bound to `node` (-1 = leave workers unpinned, e.g. for
+// interleaved or local allocations).
+void zenith_numa_first_touch(void *ptr, size_t size, int32_t node);
+
+// Parallel read-only pre-fault (numa_touch.cpp). Faults every page of a
+// mapping without writing, for file-backed memory whose placement is
+// already fixed by mbind; the thread team stays unpinned.
+void zenith_numa_prefault(const void *ptr, size_t size);
+
+// Memory-ops dispatch (memops.cpp): probes the host CPU and installs the
+// widest supported SIMD kernels. Called once from zenith_numa_init; safe
+// to call repeatedly.
+void zenith_memops_select(void);
+
+// Topology snapshot builder (numa_topology.cpp), called once from
+// zenith_numa_init after NUMA availability is confirmed.
+void zenith_numa_topology_build(void);
+
+// Allocation statistics hooks (numa_stats.cpp). All record into relaxed
+// thread-local counters; aggregation happens in zenith_numa_get_stats.
+void zenith_numa_stats_record_alloc(int32_t node, size_t bytes, uint64_t ns);
+void zenith_numa_stats_record_free(size_t bytes, uint64_t ns);
+void zenith_numa_stats_record_bind(void);
+
+// Huge-page registry hook (numa_huge.cpp). Returns true when `ptr` was a
+// huge-page mapping and has been released via munmap; zenith_numa_free
+// must not touch it further in that case.
+bool zenith_numa_huge_free(void *ptr);
+
+// Pinned-allocation registry hook (numa_pinned.cpp). Returns true when
+// `ptr` was a pinned buffer; it has been deregistered and munlock'd and
+// must bypass the recycle cache on its way to numa_free.
+bool zenith_numa_pinned_unpin(void *ptr);
+
+// Deferred-reclaim recycle cache hooks (numa_recycle.cpp). Release parks
+// a freed buffer on its node's cache (MADV_FREE applied) and returns
+// true when it took ownership; acquire hands back a cached same-size
+// block on `node`, or nullptr. The acquiring allocator must re-touch the
+// block since MADV_FREE pages may have been reclaimed in the meantime.
+bool zenith_numa_recycle_release(void *ptr, size_t size);
+void *zenith_numa_recycle_acquire(size_t size, int32_t node);
+void zenith_numa_recycle_shutdown(void);
+
+// Pre-warm subsystem shutdown (numa_prewarm.cpp): stops the per-node
+// workers and releases buffers nobody took.
+void zenith_numa_prewarm_shutdown(void);
+
+// Memory monitor shutdown (numa_monitor.cpp): stops the refresh thread;
+// the last snapshot remains readable.
+void zenith_numa_monitor_shutdown(void);
+
+#endif // ZENITH_NUMA_INTERNAL_H
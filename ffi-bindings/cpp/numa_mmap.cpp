@@ -0,0 +1,128 @@
+/**
+ * Zenith NUMA Backend - Policy-Aware File Mapping
+ *
+ * mmap for dataset files with explicit page placement: the memory
+ * policy is applied with mbind() before any page faults, so a mapped
+ * shard can be interleaved across nodes or pinned to one instead of
+ * landing wholesale on whichever node's workers touched it first. An
+ * optional pre-fault pass walks the mapping with a parallel read team
+ * so the faults happen up front rather than on the batch critical path.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if ZENITH_USE_LIBNUMA
+#include <numa.h>
+#include <numaif.h>
+#endif
+
+#ifdef __linux__
+
+extern "C" {
+
+void *zenith_numa_mmap_file(int32_t fd, uint64_t offset, size_t len,
+                            int32_t policy, uint64_t nodemask) {
+  if (fd < 0 || len == 0) {
+    return nullptr;
+  }
+
+  long page_size = sysconf(_SC_PAGESIZE);
+  if (page_size > 0 && (offset % static_cast<uint64_t>(page_size)) != 0) {
+    return nullptr;
+  }
+
+  void *ptr = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd,
+                   static_cast<off_t>(offset));
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+
+  int32_t placement = policy & ~ZENITH_NUMA_MMAP_PREFAULT;
+
+#if ZENITH_USE_LIBNUMA
+  if (placement != ZENITH_NUMA_MMAP_DEFAULT) {
+    int mode;
+    switch (placement) {
+    case ZENITH_NUMA_MMAP_BIND:
+      mode = MPOL_BIND;
+      break;
+    case ZENITH_NUMA_MMAP_INTERLEAVE:
+      mode = MPOL_INTERLEAVE;
+      break;
+    default:
+      munmap(ptr, len);
+      return nullptr;
+    }
+
+    unsigned long mask = nodemask;
+    if (mask == 0) {
+      // All configured nodes
+      int num_nodes = numa_num_configured_nodes();
+      mask = num_nodes >= 64 ? ~0ul : (1ul << num_nodes) - 1;
+    }
+    if (mbind(ptr, len, mode, &mask, sizeof(mask) * 8 + 1, 0) != 0) {
+      munmap(ptr, len);
+      return nullptr;
+    }
+  }
+#else
+  // Without libnuma there is no mbind; only the default policy is
+  // honoured, matching the stub behaviour of the allocators.
+  if (placement != ZENITH_NUMA_MMAP_DEFAULT) {
+    munmap(ptr, len);
+    return nullptr;
+  }
+  (void)nodemask;
+#endif
+
+  if (policy & ZENITH_NUMA_MMAP_PREFAULT) {
+    zenith_numa_prefault(ptr, len);
+  }
+
+  return ptr;
+}
+
+int32_t zenith_numa_munmap_file(void *ptr, size_t len) {
+  if (ptr == nullptr || len == 0) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  return munmap(ptr, len) == 0 ? ZENITH_NUMA_OK
+                               : ZENITH_NUMA_ERR_ALLOC_FAILED;
+}
+
+} // extern "C"
+
+#else // Fallback stubs (non-Linux)
+
+extern "C" {
+
+void *zenith_numa_mmap_file(int32_t fd, uint64_t offset, size_t len,
+                            int32_t policy, uint64_t nodemask) {
+  (void)fd;
+  (void)offset;
+  (void)len;
+  (void)policy;
+  (void)nodemask;
+  return nullptr;
+}
+
+int32_t zenith_numa_munmap_file(void *ptr, size_t len) {
+  (void)ptr;
+  (void)len;
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+} // extern "C"
+
+#endif // __linux__
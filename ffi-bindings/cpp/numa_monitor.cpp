@@ -0,0 +1,184 @@
+/**
+ * Zenith NUMA Backend - Memory-Pressure Monitor
+ *
+ * Caches per-node total/free memory in an atomic snapshot refreshed by
+ * a background thread, so admission control reads a relaxed load
+ * instead of paying the sysfs read inside numa_node_size64 on every
+ * allocation decision. Watermark crossings fire an edge-triggered
+ * callback per node so pools and caches can trim before allocations
+ * start failing.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if ZENITH_USE_LIBNUMA
+#include <numa.h>
+#endif
+
+namespace {
+
+constexpr int kMaxNodes = ZENITH_NUMA_MAX_NODES;
+
+std::atomic<uint64_t> g_free_bytes[kMaxNodes];
+std::atomic<uint64_t> g_total_bytes[kMaxNodes];
+
+#if ZENITH_USE_LIBNUMA
+
+constexpr uint32_t kDefaultIntervalMs = 100;
+
+// Callback configuration, guarded by the monitor mutex; the snapshot
+// itself is lock-free
+ZenithPressureFn g_callback = nullptr;
+void *g_callback_data = nullptr;
+uint32_t g_watermark_pct = 0;
+bool g_below_watermark[kMaxNodes] = {};
+
+std::mutex g_monitor_mutex;
+std::condition_variable g_monitor_cv;
+std::thread g_monitor;
+uint32_t g_interval_ms = kDefaultIntervalMs;
+bool g_monitor_running = false;
+bool g_monitor_stop = false;
+
+// One refresh pass; returns with the monitor mutex held by the caller
+void refresh_snapshot() {
+  int num_nodes = numa_num_configured_nodes();
+  if (num_nodes > kMaxNodes) {
+    num_nodes = kMaxNodes;
+  }
+
+  for (int node = 0; node < num_nodes; node++) {
+    long long free_mem = 0;
+    long long total = numa_node_size64(node, &free_mem);
+    if (total < 0) {
+      continue;
+    }
+    g_total_bytes[node].store(static_cast<uint64_t>(total),
+                              std::memory_order_relaxed);
+    g_free_bytes[node].store(static_cast<uint64_t>(free_mem),
+                             std::memory_order_relaxed);
+
+    if (g_callback != nullptr && total > 0) {
+      bool below = static_cast<uint64_t>(free_mem) * 100 <
+                   static_cast<uint64_t>(total) * g_watermark_pct;
+      if (below != g_below_watermark[node]) {
+        g_below_watermark[node] = below;
+        g_callback(node, static_cast<uint64_t>(free_mem),
+                   static_cast<uint64_t>(total), below ? 1 : 0,
+                   g_callback_data);
+      }
+    }
+  }
+}
+
+void monitor_main() {
+  std::unique_lock<std::mutex> lock(g_monitor_mutex);
+  while (!g_monitor_stop) {
+    refresh_snapshot();
+    g_monitor_cv.wait_for(lock, std::chrono::milliseconds(g_interval_ms));
+  }
+}
+
+#endif // ZENITH_USE_LIBNUMA
+
+} // namespace
+
+// Called from zenith_numa_cleanup
+void zenith_numa_monitor_shutdown(void) { zenith_numa_monitor_stop(); }
+
+extern "C" {
+
+#if ZENITH_USE_LIBNUMA
+
+int32_t zenith_numa_monitor_start(uint32_t interval_ms) {
+  if (!g_numa_initialized) {
+    return ZENITH_NUMA_ERR_UNAVAILABLE;
+  }
+
+  std::lock_guard<std::mutex> lock(g_monitor_mutex);
+  g_interval_ms = interval_ms != 0 ? interval_ms : kDefaultIntervalMs;
+  if (!g_monitor_running) {
+    g_monitor_stop = false;
+    g_monitor = std::thread(monitor_main);
+    g_monitor_running = true;
+  }
+  return ZENITH_NUMA_OK;
+}
+
+void zenith_numa_monitor_stop(void) {
+  {
+    std::lock_guard<std::mutex> lock(g_monitor_mutex);
+    if (!g_monitor_running) {
+      return;
+    }
+    g_monitor_stop = true;
+  }
+  g_monitor_cv.notify_all();
+  g_monitor.join();
+  {
+    std::lock_guard<std::mutex> lock(g_monitor_mutex);
+    g_monitor_running = false;
+  }
+}
+
+int32_t zenith_numa_set_pressure_callback(ZenithPressureFn fn,
+                                          void *user_data,
+                                          uint32_t watermark_pct) {
+  if (watermark_pct > 100) {
+    return ZENITH_NUMA_ERR_ALLOC_FAILED;
+  }
+
+  std::lock_guard<std::mutex> lock(g_monitor_mutex);
+  g_callback = fn;
+  g_callback_data = user_data;
+  g_watermark_pct = watermark_pct;
+  for (int node = 0; node < kMaxNodes; node++) {
+    g_below_watermark[node] = false;
+  }
+  return ZENITH_NUMA_OK;
+}
+
+#else // Fallback stubs (no libnuma available)
+
+int32_t zenith_numa_monitor_start(uint32_t interval_ms) {
+  (void)interval_ms;
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+void zenith_numa_monitor_stop(void) {}
+
+int32_t zenith_numa_set_pressure_callback(ZenithPressureFn fn,
+                                          void *user_data,
+                                          uint32_t watermark_pct) {
+  (void)fn;
+  (void)user_data;
+  (void)watermark_pct;
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+#endif // ZENITH_USE_LIBNUMA
+
+uint64_t zenith_numa_node_free_cached(int32_t node) {
+  if (node < 0 || node >= kMaxNodes) {
+    return 0;
+  }
+  return g_free_bytes[node].load(std::memory_order_relaxed);
+}
+
+uint64_t zenith_numa_node_total_cached(int32_t node) {
+  if (node < 0 || node >= kMaxNodes) {
+    return 0;
+  }
+  return g_total_bytes[node].load(std::memory_order_relaxed);
+}
+
+} // extern "C"
@@ -0,0 +1,114 @@
+/**
+ * Zenith NUMA Backend - Pinned Allocation for DMA Staging
+ *
+ * Page-locked node-bound buffers: allocated with the normal node-bound
+ * path, then mlock'd so the pages stay resident under device
+ * transfers. With CUDA support compiled in the buffer is also
+ * host-registered, so one buffer serves as both the disk-read target
+ * and the cudaMemcpyAsync source. A registry mirrors the huge-page
+ * bookkeeping so zenith_numa_free unpins transparently.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#if defined(ZENITH_HAS_CUDA)
+#include <cuda_runtime.h>
+#endif
+
+namespace {
+
+struct PinnedAlloc {
+  size_t size;
+};
+
+std::mutex g_pinned_mutex;
+std::unordered_map<void *, PinnedAlloc> g_pinned_allocs;
+
+} // namespace
+
+// Called from zenith_numa_free ahead of the recycle cache: pinned
+// buffers must be deregistered and unlocked, and never parked with
+// MADV_FREE. Returns true when `ptr` was pinned (it is now unpinned and
+// still owned by the caller's free path).
+bool zenith_numa_pinned_unpin(void *ptr) {
+  size_t size;
+  {
+    std::lock_guard<std::mutex> lock(g_pinned_mutex);
+    auto it = g_pinned_allocs.find(ptr);
+    if (it == g_pinned_allocs.end()) {
+      return false;
+    }
+    size = it->second.size;
+    g_pinned_allocs.erase(it);
+  }
+
+#if defined(ZENITH_HAS_CUDA)
+  cudaHostUnregister(ptr);
+#endif
+#ifdef __linux__
+  munlock(ptr, size);
+#else
+  (void)size;
+#endif
+  return true;
+}
+
+extern "C" {
+
+void *zenith_numa_alloc_pinned(size_t size, int32_t node) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  // First-touch before mlock so every page exists on the node already
+  void *ptr = zenith_numa_alloc_onnode(size, node);
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+
+#ifdef __linux__
+  if (mlock(ptr, size) != 0) {
+    // RLIMIT_MEMLOCK or similar; a silently unpinned buffer would be a
+    // correctness bug for DMA callers, so fail loudly
+    zenith_numa_free(ptr, size);
+    return nullptr;
+  }
+#endif
+
+#if defined(ZENITH_HAS_CUDA)
+  if (cudaHostRegister(ptr, size, cudaHostRegisterDefault) != cudaSuccess) {
+#ifdef __linux__
+    munlock(ptr, size);
+#endif
+    zenith_numa_free(ptr, size);
+    return nullptr;
+  }
+#endif
+
+  {
+    std::lock_guard<std::mutex> lock(g_pinned_mutex);
+    g_pinned_allocs.emplace(ptr, PinnedAlloc{size});
+  }
+  return ptr;
+}
+
+int32_t zenith_numa_is_pinned(const void *ptr) {
+  if (ptr == nullptr) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(g_pinned_mutex);
+  return g_pinned_allocs.count(const_cast<void *>(ptr)) != 0 ? 1 : 0;
+}
+
+} // extern "C"
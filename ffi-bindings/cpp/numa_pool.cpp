@@ -0,0 +1,175 @@
+/**
+ * Zenith NUMA Backend - Pooled Allocator
+ *
+ * Per-node, size-classed buffer pools layered over zenith_numa_alloc_onnode.
+ * A pool carves one node-bound slab into fixed-size buffers and recycles
+ * them through a lock-free freelist, so steady-state allocation is a single
+ * atomic pop with no mmap/mbind syscalls.
+ *
+ * The freelist is an index-based Treiber stack. The head packs a 32-bit
+ * slot index (biased by 1 so 0 means "empty") with a 32-bit ABA tag in one
+ * 64-bit word, which keeps pops safe under concurrent free/alloc.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace {
+
+constexpr size_t kCacheLine = 64;
+
+inline size_t round_up(size_t value, size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+// Head word layout: low 32 bits = slot index + 1 (0 = empty list),
+// high 32 bits = monotonically increasing ABA tag.
+inline uint64_t pack_head(uint32_t biased_index, uint32_t tag) {
+  return (static_cast<uint64_t>(tag) << 32) | biased_index;
+}
+
+inline uint32_t head_index(uint64_t head) {
+  return static_cast<uint32_t>(head & 0xffffffffu);
+}
+
+inline uint32_t head_tag(uint64_t head) {
+  return static_cast<uint32_t>(head >> 32);
+}
+
+struct NumaPool {
+  int32_t node;
+  size_t size_class; // rounded up to a cache-line multiple
+  uint32_t capacity;
+  uint8_t *slab;
+  size_t slab_size;
+  uint32_t *next;               // per-slot next link, biased by 1, 0 = end
+  std::atomic<uint64_t> head;   // packed freelist head (index + ABA tag)
+
+  uint8_t *slot_ptr(uint32_t index) { return slab + index * size_class; }
+
+  bool owns(const void *ptr) const {
+    const uint8_t *p = static_cast<const uint8_t *>(ptr);
+    return p >= slab && p < slab + slab_size;
+  }
+};
+
+} // namespace
+
+extern "C" {
+
+ZenithNumaPool zenith_numa_pool_create(int32_t node, size_t size_class,
+                                       uint32_t capacity) {
+  if (size_class == 0 || capacity == 0) {
+    return nullptr;
+  }
+
+  NumaPool *pool = new (std::nothrow) NumaPool();
+  if (pool == nullptr) {
+    return nullptr;
+  }
+
+  pool->node = node;
+  pool->size_class = round_up(size_class, kCacheLine);
+  pool->capacity = capacity;
+  pool->slab_size = pool->size_class * capacity;
+
+  pool->slab = static_cast<uint8_t *>(
+      zenith_numa_alloc_onnode(pool->slab_size, node));
+  if (pool->slab == nullptr) {
+    delete pool;
+    return nullptr;
+  }
+
+  pool->next = new (std::nothrow) uint32_t[capacity];
+  if (pool->next == nullptr) {
+    zenith_numa_free(pool->slab, pool->slab_size);
+    delete pool;
+    return nullptr;
+  }
+
+  // Thread every slot onto the freelist: slot i -> slot i+1, last -> end.
+  for (uint32_t i = 0; i + 1 < capacity; i++) {
+    pool->next[i] = i + 2; // biased by 1
+  }
+  pool->next[capacity - 1] = 0;
+  pool->head.store(pack_head(1, 0), std::memory_order_relaxed);
+
+  return pool;
+}
+
+void *zenith_numa_pool_alloc(ZenithNumaPool handle) {
+  NumaPool *pool = static_cast<NumaPool *>(handle);
+  if (pool == nullptr) {
+    return nullptr;
+  }
+
+  uint64_t head = pool->head.load(std::memory_order_acquire);
+  for (;;) {
+    uint32_t biased = head_index(head);
+    if (biased == 0) {
+      // Pool exhausted: fall back to a direct node-bound allocation so
+      // callers never see transient nullptrs. zenith_numa_pool_free routes
+      // out-of-slab pointers back to zenith_numa_free.
+      return zenith_numa_alloc_onnode(pool->size_class, pool->node);
+    }
+
+    uint32_t index = biased - 1;
+    uint64_t next_head = pack_head(pool->next[index], head_tag(head) + 1);
+    if (pool->head.compare_exchange_weak(head, next_head,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+      return pool->slot_ptr(index);
+    }
+  }
+}
+
+int32_t zenith_numa_pool_free(ZenithNumaPool handle, void *ptr) {
+  NumaPool *pool = static_cast<NumaPool *>(handle);
+  if (pool == nullptr || ptr == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+
+  if (!pool->owns(ptr)) {
+    // Overflow allocation made by zenith_numa_pool_alloc's fallback path.
+    zenith_numa_free(ptr, pool->size_class);
+    return ZENITH_NUMA_OK;
+  }
+
+  size_t offset = static_cast<uint8_t *>(ptr) - pool->slab;
+  if (offset % pool->size_class != 0) {
+    return ZENITH_NUMA_ERR_INVALID_NODE;
+  }
+  uint32_t index = static_cast<uint32_t>(offset / pool->size_class);
+
+  uint64_t head = pool->head.load(std::memory_order_acquire);
+  for (;;) {
+    pool->next[index] = head_index(head);
+    uint64_t next_head = pack_head(index + 1, head_tag(head) + 1);
+    if (pool->head.compare_exchange_weak(head, next_head,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+      return ZENITH_NUMA_OK;
+    }
+  }
+}
+
+void zenith_numa_pool_destroy(ZenithNumaPool handle) {
+  NumaPool *pool = static_cast<NumaPool *>(handle);
+  if (pool == nullptr) {
+    return;
+  }
+
+  zenith_numa_free(pool->slab, pool->slab_size);
+  delete[] pool->next;
+  delete pool;
+}
+
+} // extern "C"
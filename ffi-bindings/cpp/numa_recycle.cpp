@@ -0,0 +1,295 @@
+/**
+ * Zenith NUMA Backend - Deferred-Reclaim Recycle Cache
+ *
+ * Optional deferred-reclaim mode for zenith_numa_free: instead of going
+ * straight to numa_free (an munmap, with TLB shootdowns across every
+ * CPU), freed buffers are marked MADV_FREE - the kernel may reclaim the
+ * pages lazily but keeps the mapping - and parked on a per-node cache
+ * for reuse by subsequent same-node allocations of the same size. Only
+ * buffers whose mapping is bound to a single node are parked;
+ * interleaved and default-policy buffers go straight to numa_free. A
+ * background trimmer returns cached buffers to the kernel when a node
+ * runs low on free memory, and a per-node byte budget bounds the cache.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#if ZENITH_USE_LIBNUMA
+#include <numa.h>
+#include <numaif.h>
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+#if ZENITH_USE_LIBNUMA
+
+constexpr int kMaxNodes = ZENITH_NUMA_MAX_NODES;
+
+// Trim a node's cache when its free memory drops below this fraction of
+// its total
+constexpr double kPressureFreeFraction = 0.10;
+
+constexpr auto kTrimInterval = std::chrono::seconds(1);
+
+struct CachedBlock {
+  void *ptr;
+  size_t size;
+};
+
+struct NodeCache {
+  std::mutex mutex;
+  std::deque<CachedBlock> blocks; // FIFO: oldest evicted first
+  uint64_t bytes = 0;
+};
+
+NodeCache g_caches[kMaxNodes];
+std::atomic<bool> g_recycle_enabled{false};
+std::atomic<uint64_t> g_max_bytes_per_node{256ull << 20};
+
+// Trimmer thread state
+std::mutex g_trimmer_mutex;
+std::condition_variable g_trimmer_cv;
+std::thread g_trimmer;
+bool g_trimmer_running = false;
+bool g_trimmer_stop = false;
+
+// Node a freed buffer may be cached on, or -1 when it must not be
+// cached at all. Only regions whose VMA policy pins them to a single
+// node (MPOL_BIND/MPOL_PREFERRED) qualify: the policy sticks to the
+// mapping, so an interleaved or default-policy buffer would stay spread
+// across nodes even after the re-touch on reuse, and handing it out for
+// a node-bound allocation would break the placement guarantee.
+int32_t recyclable_node(void *ptr) {
+  constexpr int kBitsPerLong = 8 * sizeof(unsigned long);
+  int mode = 0;
+  unsigned long mask[kMaxNodes / kBitsPerLong] = {0};
+  if (get_mempolicy(&mode, mask, kMaxNodes + 1, ptr, MPOL_F_ADDR) != 0) {
+    return -1;
+  }
+  if (mode != MPOL_BIND && mode != MPOL_PREFERRED) {
+    return -1;
+  }
+  int node = -1;
+  for (int i = 0; i < kMaxNodes; i++) {
+    if (mask[i / kBitsPerLong] & (1ul << (i % kBitsPerLong))) {
+      if (node >= 0) {
+        return -1; // bound to more than one node
+      }
+      node = i;
+    }
+  }
+  return node;
+}
+
+// Unmap every cached block on one node
+void flush_node(NodeCache &cache) {
+  std::deque<CachedBlock> victims;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    victims.swap(cache.blocks);
+    cache.bytes = 0;
+  }
+  for (const CachedBlock &block : victims) {
+    numa_free(block.ptr, block.size);
+  }
+}
+
+bool node_under_pressure(int node) {
+  long long free_mem = 0;
+  long long total = numa_node_size64(node, &free_mem);
+  if (total <= 0) {
+    return false;
+  }
+  return static_cast<double>(free_mem) <
+         static_cast<double>(total) * kPressureFreeFraction;
+}
+
+void trimmer_main() {
+  std::unique_lock<std::mutex> lock(g_trimmer_mutex);
+  while (!g_trimmer_stop) {
+    g_trimmer_cv.wait_for(lock, kTrimInterval);
+    if (g_trimmer_stop) {
+      break;
+    }
+    lock.unlock();
+    int num_nodes = numa_num_configured_nodes();
+    for (int node = 0; node < num_nodes && node < kMaxNodes; node++) {
+      if (node_under_pressure(node)) {
+        flush_node(g_caches[node]);
+      }
+    }
+    lock.lock();
+  }
+}
+
+void start_trimmer() {
+  std::lock_guard<std::mutex> lock(g_trimmer_mutex);
+  if (!g_trimmer_running) {
+    g_trimmer_stop = false;
+    g_trimmer = std::thread(trimmer_main);
+    g_trimmer_running = true;
+  }
+}
+
+void stop_trimmer() {
+  {
+    std::lock_guard<std::mutex> lock(g_trimmer_mutex);
+    if (!g_trimmer_running) {
+      return;
+    }
+    g_trimmer_stop = true;
+  }
+  g_trimmer_cv.notify_all();
+  g_trimmer.join();
+  {
+    std::lock_guard<std::mutex> lock(g_trimmer_mutex);
+    g_trimmer_running = false;
+  }
+}
+
+#endif // ZENITH_USE_LIBNUMA
+
+} // namespace
+
+#if ZENITH_USE_LIBNUMA
+
+// Called from zenith_numa_free. Returns true when the buffer was parked
+// on its node's cache instead of being unmapped.
+bool zenith_numa_recycle_release(void *ptr, size_t size) {
+  if (!g_recycle_enabled.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  int node = recyclable_node(ptr);
+  if (node < 0 || node >= kMaxNodes) {
+    return false; // not single-node-bound: fall through to numa_free
+  }
+
+  NodeCache &cache = g_caches[node];
+  uint64_t budget = g_max_bytes_per_node.load(std::memory_order_relaxed);
+
+  std::deque<CachedBlock> evicted;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (size > budget) {
+      return false; // never cache blocks larger than the whole budget
+    }
+    // Let the kernel reclaim the pages lazily while we keep the mapping
+    madvise(ptr, size, MADV_FREE);
+    cache.blocks.push_back(CachedBlock{ptr, size});
+    cache.bytes += size;
+    while (cache.bytes > budget && !cache.blocks.empty()) {
+      evicted.push_back(cache.blocks.front());
+      cache.bytes -= cache.blocks.front().size;
+      cache.blocks.pop_front();
+    }
+  }
+  for (const CachedBlock &block : evicted) {
+    numa_free(block.ptr, block.size);
+  }
+  return true;
+}
+
+// Called from the allocation path. Returns a cached same-size block from
+// the node, or nullptr. The caller re-touches the block, since MADV_FREE
+// pages may have been reclaimed.
+void *zenith_numa_recycle_acquire(size_t size, int32_t node) {
+  if (!g_recycle_enabled.load(std::memory_order_relaxed) || node < 0 ||
+      node >= kMaxNodes) {
+    return nullptr;
+  }
+
+  NodeCache &cache = g_caches[node];
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  for (auto it = cache.blocks.begin(); it != cache.blocks.end(); ++it) {
+    if (it->size == size) {
+      void *ptr = it->ptr;
+      cache.bytes -= it->size;
+      cache.blocks.erase(it);
+      // Cancel the lazy reclaim for pages not yet taken back
+      madvise(ptr, size, MADV_WILLNEED);
+      return ptr;
+    }
+  }
+  return nullptr;
+}
+
+// Called from zenith_numa_cleanup
+void zenith_numa_recycle_shutdown(void) {
+  g_recycle_enabled.store(false, std::memory_order_relaxed);
+  stop_trimmer();
+  for (int node = 0; node < kMaxNodes; node++) {
+    flush_node(g_caches[node]);
+  }
+}
+
+extern "C" {
+
+int32_t zenith_numa_set_recycle(int32_t enabled, uint64_t max_bytes_per_node) {
+  if (!g_numa_initialized) {
+    return ZENITH_NUMA_ERR_UNAVAILABLE;
+  }
+
+  if (enabled) {
+    if (max_bytes_per_node != 0) {
+      g_max_bytes_per_node.store(max_bytes_per_node,
+                                 std::memory_order_relaxed);
+    }
+    g_recycle_enabled.store(true, std::memory_order_relaxed);
+    start_trimmer();
+  } else {
+    g_recycle_enabled.store(false, std::memory_order_relaxed);
+    stop_trimmer();
+    zenith_numa_recycle_flush();
+  }
+  return ZENITH_NUMA_OK;
+}
+
+void zenith_numa_recycle_flush(void) {
+  for (int node = 0; node < kMaxNodes; node++) {
+    flush_node(g_caches[node]);
+  }
+}
+
+} // extern "C"
+
+#else // Fallback stubs (no libnuma available)
+
+bool zenith_numa_recycle_release(void *ptr, size_t size) {
+  (void)ptr;
+  (void)size;
+  return false;
+}
+
+void *zenith_numa_recycle_acquire(size_t size, int32_t node) {
+  (void)size;
+  (void)node;
+  return nullptr;
+}
+
+void zenith_numa_recycle_shutdown(void) {}
+
+extern "C" {
+
+int32_t zenith_numa_set_recycle(int32_t enabled, uint64_t max_bytes_per_node) {
+  (void)enabled;
+  (void)max_bytes_per_node;
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+void zenith_numa_recycle_flush(void) {}
+
+} // extern "C"
+
+#endif // ZENITH_USE_LIBNUMA
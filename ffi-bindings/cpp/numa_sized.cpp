@@ -0,0 +1,52 @@
+/**
+ * Zenith NUMA Backend - Size-Specialized Allocation Shims
+ *
+ * extern "C" entry points over the templated core in numa_sized.h,
+ * instantiated for the three size classes production traffic is
+ * dominated by: 4 KB control blocks, 2 MB image buffers, and 16 MB
+ * shard chunks. Each shim is a direct call into one fully specialized
+ * instantiation, so FFI callers get the compile-time-resolved fast
+ * path with no runtime size-class dispatch.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_sized.h"
+
+namespace {
+
+constexpr size_t kClass4K = 4096;
+constexpr size_t kClass2M = 2u << 20;
+constexpr size_t kClass16M = 16u << 20;
+
+} // namespace
+
+extern "C" {
+
+void *zenith_numa_alloc_4k_onnode(int32_t node) {
+  return zenith::SizedAlloc<kClass4K>::alloc(node);
+}
+
+void *zenith_numa_alloc_2m_onnode(int32_t node) {
+  return zenith::SizedAlloc<kClass2M>::alloc(node);
+}
+
+void *zenith_numa_alloc_16m_onnode(int32_t node) {
+  return zenith::SizedAlloc<kClass16M>::alloc(node);
+}
+
+void zenith_numa_free_4k(void *ptr, int32_t node) {
+  zenith::SizedAlloc<kClass4K>::release(ptr, node);
+}
+
+void zenith_numa_free_2m(void *ptr, int32_t node) {
+  zenith::SizedAlloc<kClass2M>::release(ptr, node);
+}
+
+void zenith_numa_free_16m(void *ptr, int32_t node) {
+  zenith::SizedAlloc<kClass16M>::release(ptr, node);
+}
+
+} // extern "C"
@@ -0,0 +1,95 @@
+/**
+ * Zenith NUMA Backend - Size-Specialized Allocation Core
+ *
+ * Templated fast paths for the allocation sizes that dominate
+ * production traffic. Everything a generic allocator decides at run
+ * time - backing page size, touch strategy, freelist layout - is
+ * resolved at compile time from the size parameter, and each
+ * instantiation keeps a small per-thread freelist so the steady-state
+ * hot path is a cache pop plus a constant-size memset with no atomics,
+ * no locks, and no syscalls. Not installed; FFI consumers use the
+ * extern "C" shims in zenith_numa.h (numa_sized.cpp).
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZENITH_NUMA_SIZED_H
+#define ZENITH_NUMA_SIZED_H
+
+#include "../zenith_numa.h"
+
+#include <cstring>
+
+namespace zenith {
+
+template <size_t Size> class SizedAlloc {
+  // 2 MB multiples go straight to the huge-page allocator; everything
+  // else takes the base-page path. Decided here, at compile time.
+  static constexpr bool kHugeBacked =
+      Size >= ZENITH_NUMA_PAGE_2MB && (Size % ZENITH_NUMA_PAGE_2MB) == 0;
+
+  // Deeper cache for small classes, shallower for large ones so an
+  // idle thread never sits on more than a few tens of megabytes
+  static constexpr size_t kCacheSlots =
+      Size >= (16u << 20) ? 2 : (Size >= (2u << 20) ? 4 : 8);
+
+  struct Cache {
+    struct Entry {
+      void *ptr;
+      int32_t node;
+    };
+    Entry entries[kCacheSlots];
+    size_t count = 0;
+
+    ~Cache() {
+      // Return whatever the thread still caches when it exits
+      for (size_t i = 0; i < count; i++) {
+        zenith_numa_free(entries[i].ptr, Size);
+      }
+    }
+  };
+
+  static Cache &cache() {
+    static thread_local Cache tls_cache;
+    return tls_cache;
+  }
+
+public:
+  static void *alloc(int32_t node) {
+    Cache &c = cache();
+    for (size_t i = 0; i < c.count; i++) {
+      if (c.entries[i].node == node) {
+        void *ptr = c.entries[i].ptr;
+        c.entries[i] = c.entries[--c.count];
+        // Preserve the zeroed-memory contract of the generic
+        // allocators; the size is a compile-time constant, so this
+        // lowers to the widest available vector fill
+        memset(ptr, 0, Size);
+        return ptr;
+      }
+    }
+    return kHugeBacked
+               ? zenith_numa_alloc_onnode_huge(Size, node,
+                                               ZENITH_NUMA_PAGE_2MB)
+               : zenith_numa_alloc_onnode(Size, node);
+  }
+
+  static void release(void *ptr, int32_t node) {
+    if (ptr == nullptr) {
+      return;
+    }
+    Cache &c = cache();
+    if (c.count < kCacheSlots) {
+      c.entries[c.count].ptr = ptr;
+      c.entries[c.count].node = node;
+      c.count++;
+      return;
+    }
+    zenith_numa_free(ptr, Size);
+  }
+};
+
+} // namespace zenith
+
+#endif // ZENITH_NUMA_SIZED_H
@@ -0,0 +1,309 @@
+/**
+ * Zenith NUMA Backend - Hot/Cold Page Tiering Engine
+ *
+ * Keeps local-node DRAM for the hot working set. A sampler thread uses
+ * soft-dirty page tracking (/proc/self/clear_refs + pagemap bit 55) to
+ * observe which chunks of registered regions were touched since the
+ * last scan. Chunks cold for several consecutive scans are demoted to a
+ * designated capacity node with the in-place migration machinery;
+ * demoted chunks that get touched again are promoted back to their
+ * home node. Tiering granularity is a 64-page chunk so metadata stays
+ * tiny even for very large caches.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if ZENITH_USE_LIBNUMA
+#include <fcntl.h>
+#include <numaif.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if ZENITH_USE_LIBNUMA
+
+constexpr size_t kPageSize = 4096;
+constexpr size_t kChunkPages = 64; // 256 KB tiering granularity
+constexpr size_t kChunkSize = kChunkPages * kPageSize;
+constexpr uint32_t kDefaultIntervalMs = 1000;
+constexpr uint32_t kDefaultColdScans = 3;
+
+struct Chunk {
+  uint8_t cold_age = 0;  // consecutive scans without a touch
+  bool demoted = false;
+};
+
+struct Region {
+  uint8_t *base;
+  size_t size;
+  int32_t home_node;
+  std::vector<Chunk> chunks;
+};
+
+std::mutex g_tier_mutex;
+std::condition_variable g_tier_cv;
+std::vector<Region> g_regions;
+std::thread g_sampler;
+bool g_tier_running = false;
+bool g_tier_stop = false;
+int32_t g_capacity_node = -1;
+uint32_t g_interval_ms = kDefaultIntervalMs;
+uint32_t g_cold_scans = kDefaultColdScans;
+
+std::atomic<uint64_t> g_bytes_demoted{0};
+std::atomic<uint64_t> g_bytes_promoted{0};
+std::atomic<uint64_t> g_scans_completed{0};
+
+int32_t node_of(void *ptr) {
+  int node = -1;
+  if (get_mempolicy(&node, nullptr, 0, ptr, MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+    return -1;
+  }
+  return node;
+}
+
+// True when any page of [base, base + len) is soft-dirty, i.e. written
+// since the last clear_refs
+bool chunk_touched(int pagemap_fd, const uint8_t *base, size_t len) {
+  uint64_t entries[kChunkPages];
+  size_t pages = len / kPageSize;
+  off_t offset =
+      static_cast<off_t>(reinterpret_cast<uintptr_t>(base) / kPageSize) * 8;
+  ssize_t got = pread(pagemap_fd, entries, pages * 8, offset);
+  if (got <= 0) {
+    return true; // cannot sample: err on the side of keeping data hot
+  }
+  for (size_t i = 0; i < static_cast<size_t>(got) / 8; i++) {
+    if (entries[i] & (1ull << 55)) { // soft-dirty
+      return true;
+    }
+  }
+  return false;
+}
+
+// Reset soft-dirty bits for the whole process, arming the next scan
+void clear_soft_dirty() {
+  int fd = open("/proc/self/clear_refs", O_WRONLY);
+  if (fd >= 0) {
+    ssize_t rc = write(fd, "4", 1);
+    (void)rc;
+    close(fd);
+  }
+}
+
+// One sampler pass over every region; caller holds the tier mutex
+void scan_regions(int pagemap_fd) {
+  for (Region &region : g_regions) {
+    for (size_t c = 0; c < region.chunks.size(); c++) {
+      Chunk &chunk = region.chunks[c];
+      uint8_t *chunk_base = region.base + c * kChunkSize;
+      size_t chunk_len = region.size - c * kChunkSize;
+      if (chunk_len > kChunkSize) {
+        chunk_len = kChunkSize;
+      }
+
+      if (chunk_touched(pagemap_fd, chunk_base, chunk_len)) {
+        chunk.cold_age = 0;
+        if (chunk.demoted) {
+          // Back in the working set: promote to the home node
+          if (zenith_numa_migrate(chunk_base, chunk_len,
+                                  region.home_node) == ZENITH_NUMA_OK) {
+            chunk.demoted = false;
+            g_bytes_promoted.fetch_add(chunk_len, std::memory_order_relaxed);
+          }
+        }
+        continue;
+      }
+
+      if (chunk.demoted) {
+        continue; // already on the capacity tier
+      }
+      if (chunk.cold_age < UINT8_MAX) {
+        chunk.cold_age++;
+      }
+      if (chunk.cold_age >= g_cold_scans) {
+        if (zenith_numa_migrate(chunk_base, chunk_len, g_capacity_node) ==
+            ZENITH_NUMA_OK) {
+          chunk.demoted = true;
+          g_bytes_demoted.fetch_add(chunk_len, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+}
+
+void sampler_main() {
+  int pagemap_fd = open("/proc/self/pagemap", O_RDONLY);
+
+  std::unique_lock<std::mutex> lock(g_tier_mutex);
+  // Arm the first interval before sampling anything
+  clear_soft_dirty();
+  while (!g_tier_stop) {
+    g_tier_cv.wait_for(lock, std::chrono::milliseconds(g_interval_ms));
+    if (g_tier_stop) {
+      break;
+    }
+    if (pagemap_fd >= 0) {
+      scan_regions(pagemap_fd);
+    }
+    clear_soft_dirty();
+    g_scans_completed.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (pagemap_fd >= 0) {
+    close(pagemap_fd);
+  }
+}
+
+#endif // ZENITH_USE_LIBNUMA
+
+} // namespace
+
+extern "C" {
+
+#if ZENITH_USE_LIBNUMA
+
+int32_t zenith_tier_configure(int32_t capacity_node,
+                              uint32_t scan_interval_ms,
+                              uint32_t cold_scans) {
+  if (!g_numa_initialized) {
+    return ZENITH_NUMA_ERR_UNAVAILABLE;
+  }
+  if (capacity_node < 0 || capacity_node >= zenith_numa_num_nodes()) {
+    return ZENITH_NUMA_ERR_INVALID_NODE;
+  }
+
+  std::lock_guard<std::mutex> lock(g_tier_mutex);
+  g_capacity_node = capacity_node;
+  g_interval_ms = scan_interval_ms != 0 ? scan_interval_ms : kDefaultIntervalMs;
+  g_cold_scans = cold_scans != 0 ? cold_scans : kDefaultColdScans;
+  if (!g_tier_running) {
+    g_tier_stop = false;
+    g_sampler = std::thread(sampler_main);
+    g_tier_running = true;
+  }
+  return ZENITH_NUMA_OK;
+}
+
+void zenith_tier_stop(void) {
+  {
+    std::lock_guard<std::mutex> lock(g_tier_mutex);
+    if (!g_tier_running) {
+      return;
+    }
+    g_tier_stop = true;
+  }
+  g_tier_cv.notify_all();
+  g_sampler.join();
+  {
+    std::lock_guard<std::mutex> lock(g_tier_mutex);
+    g_tier_running = false;
+    g_regions.clear();
+  }
+}
+
+int32_t zenith_tier_register(void *ptr, size_t size) {
+  if (ptr == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  if (size == 0) {
+    return ZENITH_NUMA_ERR_ALLOC_FAILED;
+  }
+
+  int32_t home = node_of(ptr);
+  if (home < 0) {
+    return ZENITH_NUMA_ERR_UNAVAILABLE;
+  }
+
+  Region region;
+  region.base = static_cast<uint8_t *>(ptr);
+  region.size = size;
+  region.home_node = home;
+  region.chunks.resize((size + kChunkSize - 1) / kChunkSize);
+
+  std::lock_guard<std::mutex> lock(g_tier_mutex);
+  g_regions.push_back(std::move(region));
+  return ZENITH_NUMA_OK;
+}
+
+int32_t zenith_tier_unregister(void *ptr) {
+  if (ptr == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+
+  std::lock_guard<std::mutex> lock(g_tier_mutex);
+  for (auto it = g_regions.begin(); it != g_regions.end(); ++it) {
+    if (it->base == ptr) {
+      g_regions.erase(it);
+      return ZENITH_NUMA_OK;
+    }
+  }
+  return ZENITH_NUMA_ERR_NULL_PTR;
+}
+
+int32_t zenith_tier_get_stats(ZenithTierStats *stats) {
+  if (stats == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(g_tier_mutex);
+    stats->regions_tracked = g_regions.size();
+  }
+  stats->bytes_demoted = g_bytes_demoted.load(std::memory_order_relaxed);
+  stats->bytes_promoted = g_bytes_promoted.load(std::memory_order_relaxed);
+  stats->scans_completed = g_scans_completed.load(std::memory_order_relaxed);
+  return ZENITH_NUMA_OK;
+}
+
+#else // Fallback stubs (no libnuma available)
+
+int32_t zenith_tier_configure(int32_t capacity_node,
+                              uint32_t scan_interval_ms,
+                              uint32_t cold_scans) {
+  (void)capacity_node;
+  (void)scan_interval_ms;
+  (void)cold_scans;
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+void zenith_tier_stop(void) {}
+
+int32_t zenith_tier_register(void *ptr, size_t size) {
+  (void)size;
+  if (ptr == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+int32_t zenith_tier_unregister(void *ptr) {
+  if (ptr == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  return ZENITH_NUMA_ERR_UNAVAILABLE;
+}
+
+int32_t zenith_tier_get_stats(ZenithTierStats *stats) {
+  if (stats == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  memset(stats, 0, sizeof(*stats));
+  return ZENITH_NUMA_OK;
+}
+
+#endif // ZENITH_USE_LIBNUMA
+
+} // extern "C"
@@ -0,0 +1,103 @@
+/**
+ * Zenith NUMA Backend - Cached Topology Snapshot
+ *
+ * Builds one flat snapshot of the machine topology (cpu->node table,
+ * per-node info, full NxN distance matrix) at zenith_numa_init time so
+ * runtime topology discovery is a single FFI call and a memcpy instead of
+ * hundreds of per-CPU / per-node-pair round trips.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <cstring>
+
+#if ZENITH_USE_LIBNUMA
+#include <numa.h>
+#endif
+
+namespace {
+
+ZenithNumaTopology g_topology;
+bool g_topology_valid = false;
+
+} // namespace
+
+#if ZENITH_USE_LIBNUMA
+
+// Called once from zenith_numa_init, after numa_available() succeeded.
+void zenith_numa_topology_build(void) {
+  memset(&g_topology, 0, sizeof(g_topology));
+
+  int num_nodes = numa_num_configured_nodes();
+  int num_cpus = numa_num_configured_cpus();
+  if (num_nodes > ZENITH_NUMA_MAX_NODES) {
+    num_nodes = ZENITH_NUMA_MAX_NODES;
+  }
+  if (num_cpus > ZENITH_NUMA_MAX_CPUS) {
+    num_cpus = ZENITH_NUMA_MAX_CPUS;
+  }
+  g_topology.num_nodes = num_nodes;
+  g_topology.num_cpus = num_cpus;
+
+  for (int cpu = 0; cpu < num_cpus; cpu++) {
+    g_topology.cpu_to_node[cpu] = numa_node_of_cpu(cpu);
+  }
+
+  struct bitmask *cpumask = numa_allocate_cpumask();
+  for (int node = 0; node < num_nodes; node++) {
+    ZenithNumaNodeInfo *info = &g_topology.nodes[node];
+    info->node_id = node;
+
+    long long free_mem = 0;
+    info->total_memory = numa_node_size64(node, &free_mem);
+    info->free_memory = static_cast<uint64_t>(free_mem);
+
+    info->num_cpus = 0;
+    if (cpumask != nullptr && numa_node_to_cpus(node, cpumask) == 0) {
+      info->num_cpus = numa_bitmask_weight(cpumask);
+    }
+
+    for (int other = 0; other < num_nodes; other++) {
+      g_topology.distance[node * ZENITH_NUMA_MAX_NODES + other] =
+          numa_distance(node, other);
+    }
+  }
+  if (cpumask != nullptr) {
+    numa_free_cpumask(cpumask);
+  }
+
+  g_topology_valid = true;
+}
+
+#else // Fallback stubs (no libnuma available)
+
+void zenith_numa_topology_build(void) {
+  memset(&g_topology, 0, sizeof(g_topology));
+  g_topology.num_nodes = 1;
+  g_topology.num_cpus = 1;
+  g_topology.nodes[0].num_cpus = 1;
+  g_topology.distance[0] = 10; // Default local distance
+  g_topology_valid = true;
+}
+
+#endif // ZENITH_USE_LIBNUMA
+
+extern "C" {
+
+int32_t zenith_numa_get_topology(ZenithNumaTopology *topology) {
+  if (topology == nullptr) {
+    return ZENITH_NUMA_ERR_NULL_PTR;
+  }
+  if (!g_numa_initialized || !g_topology_valid) {
+    return ZENITH_NUMA_ERR_UNAVAILABLE;
+  }
+
+  memcpy(topology, &g_topology, sizeof(g_topology));
+  return ZENITH_NUMA_OK;
+}
+
+} // extern "C"
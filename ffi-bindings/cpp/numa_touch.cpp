@@ -0,0 +1,126 @@
+/**
+ * Zenith NUMA Backend - Parallel First-Touch Engine
+ *
+ * Fans the first-touch page zeroing of large allocations out across a
+ * temporary thread team so multi-GB staging arenas fault in at memory
+ * bandwidth instead of serializing on the calling thread. Workers bind to
+ * the target node (when one is given) so the pages land where the buffer
+ * was placed.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_numa.h"
+#include "numa_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Below this size the thread spawn overhead exceeds the memset win.
+constexpr size_t kParallelTouchThreshold = 8u << 20; // 8 MB
+
+constexpr size_t kPageSize = 4096;
+
+constexpr unsigned kMaxTouchThreads = 16;
+
+unsigned touch_thread_count(int32_t node) {
+  unsigned hw = std::thread::hardware_concurrency();
+  if (hw == 0) {
+    hw = 1;
+  }
+
+  // Never use more threads than the target node has CPUs.
+  if (node >= 0) {
+    ZenithNumaNodeInfo info = {};
+    if (zenith_numa_get_node_info(node, &info) == ZENITH_NUMA_OK &&
+        info.num_cpus > 0) {
+      hw = std::min(hw, static_cast<unsigned>(info.num_cpus));
+    }
+  }
+
+  return std::min(hw, kMaxTouchThreads);
+}
+
+} // namespace
+
+void zenith_numa_prefault(const void *ptr, size_t size) {
+  if (ptr == nullptr || size == 0) {
+    return;
+  }
+
+  // Read one byte per page; placement is governed by the mapping's
+  // memory policy, so the workers stay unpinned.
+  auto fault_range = [](const uint8_t *base, size_t len) {
+    volatile uint8_t sink = 0;
+    for (size_t i = 0; i < len; i += kPageSize) {
+      sink += base[i];
+    }
+    (void)sink;
+  };
+
+  const uint8_t *base = static_cast<const uint8_t *>(ptr);
+  unsigned threads = touch_thread_count(-1);
+  if (size < kParallelTouchThreshold || threads <= 1) {
+    fault_range(base, size);
+    return;
+  }
+
+  size_t chunk = ((size / threads) + kPageSize - 1) & ~(kPageSize - 1);
+  std::vector<std::thread> team;
+  team.reserve(threads);
+  for (unsigned t = 0; t < threads; t++) {
+    size_t begin = t * chunk;
+    if (begin >= size) {
+      break;
+    }
+    size_t len = std::min(chunk, size - begin);
+    team.emplace_back(
+        [fault_range, base, begin, len]() { fault_range(base + begin, len); });
+  }
+
+  for (auto &worker : team) {
+    worker.join();
+  }
+}
+
+void zenith_numa_first_touch(void *ptr, size_t size, int32_t node) {
+  if (ptr == nullptr || size == 0) {
+    return;
+  }
+
+  unsigned threads = touch_thread_count(node);
+  if (size < kParallelTouchThreshold || threads <= 1) {
+    memset(ptr, 0, size);
+    return;
+  }
+
+  // Split the buffer into page-aligned chunks, one per worker.
+  size_t chunk = ((size / threads) + kPageSize - 1) & ~(kPageSize - 1);
+  uint8_t *base = static_cast<uint8_t *>(ptr);
+
+  std::vector<std::thread> team;
+  team.reserve(threads);
+  for (unsigned t = 0; t < threads; t++) {
+    size_t begin = t * chunk;
+    if (begin >= size) {
+      break;
+    }
+    size_t len = std::min(chunk, size - begin);
+    team.emplace_back([base, begin, len, node]() {
+      if (node >= 0) {
+        // Best effort: touching still works unpinned, just slower.
+        zenith_numa_bind_thread_to_node(node);
+      }
+      memset(base + begin, 0, len);
+    });
+  }
+
+  for (auto &worker : team) {
+    worker.join();
+  }
+}
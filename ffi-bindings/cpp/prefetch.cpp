@@ -0,0 +1,96 @@
+/**
+ * Zenith Prefetch - C++ Implementation
+ *
+ * Batched MADV_WILLNEED planning. Scattered read-ahead ranges are
+ * page-aligned, sorted, and coalesced so a scan over many small sample
+ * extents triggers a handful of madvise calls instead of one per
+ * extent.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_prefetch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+extern "C" {
+
+#ifdef __linux__
+
+int32_t zenith_prefetch_plan(const ZenithPrefetchRange *ranges, size_t n) {
+  if (ranges == nullptr) {
+    return -1;
+  }
+  if (n == 0) {
+    return 0;
+  }
+
+  long page = sysconf(_SC_PAGESIZE);
+  const uintptr_t page_mask = ~(static_cast<uintptr_t>(page) - 1);
+
+  // Page-align every range and drop empty ones
+  struct Span {
+    uintptr_t begin;
+    uintptr_t end;
+  };
+  std::vector<Span> spans;
+  spans.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    if (ranges[i].addr == nullptr || ranges[i].len == 0) {
+      continue;
+    }
+    uintptr_t begin = reinterpret_cast<uintptr_t>(ranges[i].addr) & page_mask;
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ranges[i].addr) +
+                     ranges[i].len + page - 1) &
+                    page_mask;
+    spans.push_back(Span{begin, end});
+  }
+  if (spans.empty()) {
+    return 0;
+  }
+
+  std::sort(spans.begin(), spans.end(),
+            [](const Span &a, const Span &b) { return a.begin < b.begin; });
+
+  // Coalesce overlapping and adjacent spans, then advise each run
+  int32_t issued = 0;
+  uintptr_t run_begin = spans[0].begin;
+  uintptr_t run_end = spans[0].end;
+  for (size_t i = 1; i <= spans.size(); i++) {
+    if (i < spans.size() && spans[i].begin <= run_end) {
+      run_end = std::max(run_end, spans[i].end);
+      continue;
+    }
+    madvise(reinterpret_cast<void *>(run_begin), run_end - run_begin,
+            MADV_WILLNEED);
+    issued++;
+    if (i < spans.size()) {
+      run_begin = spans[i].begin;
+      run_end = spans[i].end;
+    }
+  }
+
+  return issued;
+}
+
+#else // Fallback stub (no madvise)
+
+int32_t zenith_prefetch_plan(const ZenithPrefetchRange *ranges, size_t n) {
+  if (ranges == nullptr) {
+    return -1;
+  }
+  (void)n;
+  return 0;
+}
+
+#endif // __linux__
+
+} // extern "C"
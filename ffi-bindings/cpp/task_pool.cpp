@@ -0,0 +1,213 @@
+/**
+ * Zenith Task Pool - C++ Implementation
+ *
+ * Work-stealing pool partitioned by NUMA node. Each node owns a task
+ * deque shared by the workers pinned there (a node's workers all push
+ * and pop it, so a shared deque under the pool lock stands in for the
+ * single-owner Chase-Lev structure); idle workers steal from the back
+ * of other nodes' deques in zenith_numa_distance() order, so work
+ * spills to near nodes before far ones.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../zenith_tasks.h"
+#include "../zenith_numa.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Task {
+  ZenithTaskFn fn;
+  void *arg;
+};
+
+struct TaskPool {
+  int32_t num_nodes;
+  std::vector<std::deque<Task>> queues; // one per node
+  std::vector<std::vector<int32_t>> steal_order; // per node, nearest first
+
+  std::mutex mutex;
+  std::condition_variable work_cv; // workers sleep here
+  std::condition_variable done_cv; // zenith_pool_wait sleeps here
+  size_t pending = 0;              // queued + running tasks
+  bool stop = false;
+
+  std::vector<std::thread> workers;
+  std::atomic<uint32_t> rr{0}; // round-robin cursor for node -1 submits
+};
+
+void worker_main(TaskPool *pool, int32_t home_node, bool pinned) {
+  if (pinned) {
+    // Best effort; an unpinned worker still drains its home queue
+    zenith_numa_bind_thread_to_node(home_node);
+  }
+
+  std::unique_lock<std::mutex> lock(pool->mutex);
+  for (;;) {
+    Task task = {nullptr, nullptr};
+
+    // Own node first (front), then steal from near nodes (back)
+    std::deque<Task> &own = pool->queues[home_node];
+    if (!own.empty()) {
+      task = own.front();
+      own.pop_front();
+    } else {
+      for (int32_t victim : pool->steal_order[home_node]) {
+        std::deque<Task> &other = pool->queues[victim];
+        if (!other.empty()) {
+          task = other.back();
+          other.pop_back();
+          break;
+        }
+      }
+    }
+
+    if (task.fn == nullptr) {
+      if (pool->stop) {
+        return;
+      }
+      pool->work_cv.wait(lock);
+      continue;
+    }
+
+    lock.unlock();
+    task.fn(task.arg);
+    lock.lock();
+
+    pool->pending--;
+    if (pool->pending == 0) {
+      pool->done_cv.notify_all();
+    }
+  }
+}
+
+} // namespace
+
+extern "C" {
+
+ZenithTaskPool zenith_pool_create(int32_t threads_per_node) {
+  if (threads_per_node < 0) {
+    return nullptr;
+  }
+
+  int32_t num_nodes = zenith_numa_num_nodes();
+  bool numa_up = num_nodes > 0;
+  if (num_nodes <= 0) {
+    num_nodes = 1; // NUMA not initialized or unavailable: one flat queue
+  }
+
+  TaskPool *pool = new TaskPool();
+  pool->num_nodes = num_nodes;
+  pool->queues.resize(num_nodes);
+
+  // Nearest-first steal order per node
+  pool->steal_order.resize(num_nodes);
+  for (int32_t node = 0; node < num_nodes; node++) {
+    std::vector<int32_t> &order = pool->steal_order[node];
+    for (int32_t other = 0; other < num_nodes; other++) {
+      if (other != node) {
+        order.push_back(other);
+      }
+    }
+    std::sort(order.begin(), order.end(),
+              [node](int32_t a, int32_t b) {
+                return zenith_numa_distance(node, a) <
+                       zenith_numa_distance(node, b);
+              });
+  }
+
+  for (int32_t node = 0; node < num_nodes; node++) {
+    int32_t count = threads_per_node;
+    if (count == 0) {
+      ZenithNumaNodeInfo info = {};
+      if (numa_up &&
+          zenith_numa_get_node_info(node, &info) == ZENITH_NUMA_OK &&
+          info.num_cpus > 0) {
+        count = info.num_cpus;
+      } else {
+        unsigned hw = std::thread::hardware_concurrency();
+        count = hw > 0 ? static_cast<int32_t>(hw) : 1;
+      }
+    }
+    for (int32_t t = 0; t < count; t++) {
+      pool->workers.emplace_back(worker_main, pool, node, numa_up);
+    }
+  }
+
+  return pool;
+}
+
+int32_t zenith_pool_submit(ZenithTaskPool handle, ZenithTaskFn fn, void *arg,
+                           int32_t preferred_node) {
+  TaskPool *pool = static_cast<TaskPool *>(handle);
+  if (pool == nullptr || fn == nullptr) {
+    return ZENITH_POOL_ERR_INVALID_ARG;
+  }
+
+  int32_t node = preferred_node;
+  if (node < 0 || node >= pool->num_nodes) {
+    node = static_cast<int32_t>(pool->rr.fetch_add(
+               1, std::memory_order_relaxed)) %
+           pool->num_nodes;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if (pool->stop) {
+      return ZENITH_POOL_ERR_INVALID_ARG;
+    }
+    pool->queues[node].push_back(Task{fn, arg});
+    pool->pending++;
+  }
+  pool->work_cv.notify_one();
+  return ZENITH_POOL_OK;
+}
+
+int32_t zenith_pool_wait(ZenithTaskPool handle) {
+  TaskPool *pool = static_cast<TaskPool *>(handle);
+  if (pool == nullptr) {
+    return ZENITH_POOL_ERR_INVALID_ARG;
+  }
+
+  std::unique_lock<std::mutex> lock(pool->mutex);
+  pool->done_cv.wait(lock, [pool]() { return pool->pending == 0; });
+  return ZENITH_POOL_OK;
+}
+
+int32_t zenith_pool_num_workers(ZenithTaskPool handle) {
+  TaskPool *pool = static_cast<TaskPool *>(handle);
+  if (pool == nullptr) {
+    return 0;
+  }
+  return static_cast<int32_t>(pool->workers.size());
+}
+
+void zenith_pool_destroy(ZenithTaskPool handle) {
+  TaskPool *pool = static_cast<TaskPool *>(handle);
+  if (pool == nullptr) {
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    // Let queued work finish before tearing the workers down
+    pool->done_cv.wait(lock, [pool]() { return pool->pending == 0; });
+    pool->stop = true;
+  }
+  pool->work_cv.notify_all();
+  for (std::thread &worker : pool->workers) {
+    worker.join();
+  }
+  delete pool;
+}
+
+} // extern "C"
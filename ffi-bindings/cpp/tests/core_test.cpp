@@ -0,0 +1,421 @@
+/**
+ * Zenith Core Backend Unit Tests
+ *
+ * Tests for the native C++ engine behind zenith_core.h.
+ * Requires Google Test.
+ *
+ * Build:
+ *   cd ffi-bindings/cpp && mkdir build && cd build
+ *   cmake .. -DBUILD_TESTS=ON && make
+ *   ./core_test
+ */
+
+#include "../zenith_core.h"
+#include "../zenith_numa.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CoreBackendTest : public ::testing::Test {
+protected:
+  void SetUp() override { engine = zenith_init(1024); }
+
+  void TearDown() override { zenith_free(engine); }
+
+  ZenithEngine engine = nullptr;
+};
+
+// Lifecycle tests
+TEST_F(CoreBackendTest, InitSucceeds) { ASSERT_NE(engine, nullptr); }
+
+TEST_F(CoreBackendTest, InitZeroSizeFails) {
+  EXPECT_EQ(zenith_init(0), nullptr);
+}
+
+// Publish/consume tests
+TEST_F(CoreBackendTest, PublishThenConsumeRoundTrips) {
+  int payload = 42;
+  ASSERT_EQ(zenith_publish(engine, &payload, nullptr, 7, 100), ZENITH_OK);
+
+  ZenithEvent event = {};
+  ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+  EXPECT_EQ(event.array_ptr, &payload);
+  EXPECT_EQ(event.source_id, 7u);
+  EXPECT_EQ(event.seq_no, 100u);
+}
+
+TEST_F(CoreBackendTest, ConsumeEmptyReturnsEmpty) {
+  ZenithEvent event = {};
+  EXPECT_EQ(zenith_consume(engine, &event), ZENITH_ERR_BUFFER_EMPTY);
+}
+
+TEST_F(CoreBackendTest, PublishFullRingReturnsFull) {
+  ZenithEngine small = zenith_init(4); // rounds up to 4 slots
+  ASSERT_NE(small, nullptr);
+
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(zenith_publish(small, nullptr, nullptr, 0, i), ZENITH_OK);
+  }
+  EXPECT_EQ(zenith_publish(small, nullptr, nullptr, 0, 4),
+            ZENITH_ERR_BUFFER_FULL);
+
+  zenith_free(small);
+}
+
+TEST_F(CoreBackendTest, NullEngineFails) {
+  EXPECT_EQ(zenith_publish(nullptr, nullptr, nullptr, 0, 0),
+            ZENITH_ERR_NULL_PTR);
+  ZenithEvent event = {};
+  EXPECT_EQ(zenith_consume(nullptr, &event), ZENITH_ERR_NULL_PTR);
+}
+
+TEST_F(CoreBackendTest, MultiProducerEventsAllArrive) {
+  const int kProducers = 4;
+  const int kPerProducer = 200;
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; p++) {
+    producers.emplace_back([this, p]() {
+      for (int i = 0; i < kPerProducer; i++) {
+        while (zenith_publish(engine, nullptr, nullptr, p, i) != ZENITH_OK) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  int consumed = 0;
+  ZenithEvent event = {};
+  while (consumed < kProducers * kPerProducer) {
+    if (zenith_consume(engine, &event) == ZENITH_OK) {
+      consumed++;
+    }
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(consumed, kProducers * kPerProducer);
+}
+
+// Batched publish tests
+TEST_F(CoreBackendTest, PublishBatchRoundTrips) {
+  ZenithEvent batch[16] = {};
+  for (int i = 0; i < 16; i++) {
+    batch[i].source_id = 3;
+    batch[i].seq_no = i;
+  }
+  ASSERT_EQ(zenith_publish_batch(engine, batch, 16), 16);
+
+  ZenithEvent event = {};
+  for (int i = 0; i < 16; i++) {
+    ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+    EXPECT_EQ(event.seq_no, static_cast<uint64_t>(i));
+  }
+  EXPECT_EQ(zenith_consume(engine, &event), ZENITH_ERR_BUFFER_EMPTY);
+}
+
+TEST_F(CoreBackendTest, PublishBatchPartialOnNearlyFullRing) {
+  ZenithEngine small = zenith_init(8);
+  ASSERT_NE(small, nullptr);
+
+  ZenithEvent batch[8] = {};
+  ASSERT_EQ(zenith_publish_batch(small, batch, 6), 6);
+  // Only 2 slots left: a batch of 8 publishes a prefix
+  EXPECT_EQ(zenith_publish_batch(small, batch, 8), 2);
+  // Full ring: 0 published, caller applies backpressure
+  EXPECT_EQ(zenith_publish_batch(small, batch, 4), 0);
+
+  zenith_free(small);
+}
+
+TEST_F(CoreBackendTest, PublishBatchNullFails) {
+  EXPECT_EQ(zenith_publish_batch(engine, nullptr, 4), ZENITH_ERR_NULL_PTR);
+}
+
+// Ownership-transfer tests
+namespace {
+void count_release(void *array_ptr, void *schema_ptr, void *user_data) {
+  (void)array_ptr;
+  (void)schema_ptr;
+  ++*static_cast<int *>(user_data);
+}
+} // namespace
+
+TEST_F(CoreBackendTest, OwnedEventReleasedAfterConsume) {
+  int released = 0;
+  int payload = 1;
+  ASSERT_EQ(zenith_publish_owned(engine, &payload, nullptr, 0, 1,
+                                 count_release, &released),
+            ZENITH_OK);
+
+  ZenithEvent event = {};
+  ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+  EXPECT_EQ(event.array_ptr, &payload);
+  EXPECT_EQ(released, 0); // consumer still holds its reference
+
+  zenith_event_release(&event);
+  EXPECT_EQ(released, 1);
+}
+
+TEST_F(CoreBackendTest, RetainDefersRelease) {
+  int released = 0;
+  ASSERT_EQ(zenith_publish_owned(engine, nullptr, nullptr, 0, 1,
+                                 count_release, &released),
+            ZENITH_OK);
+
+  ZenithEvent event = {};
+  ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+
+  ZenithEvent second = event;
+  zenith_event_retain(&second);
+
+  zenith_event_release(&event);
+  EXPECT_EQ(released, 0);
+  zenith_event_release(&second);
+  EXPECT_EQ(released, 1);
+}
+
+TEST_F(CoreBackendTest, UnconsumedOwnedEventsReleasedOnFree) {
+  int released = 0;
+  ZenithEngine local = zenith_init(8);
+  ASSERT_NE(local, nullptr);
+  ASSERT_EQ(zenith_publish_owned(local, nullptr, nullptr, 0, 1, count_release,
+                                 &released),
+            ZENITH_OK);
+  zenith_free(local);
+  EXPECT_EQ(released, 1);
+}
+
+TEST_F(CoreBackendTest, ReleaseIsNoOpForPlainEvents) {
+  ASSERT_EQ(zenith_publish(engine, nullptr, nullptr, 0, 1), ZENITH_OK);
+  ZenithEvent event = {};
+  ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+  EXPECT_EQ(event.owner, nullptr);
+  zenith_event_release(&event); // must not crash
+}
+
+// Stats tests
+TEST_F(CoreBackendTest, StatsTrackPublishes) {
+  ZenithStats stats = {};
+  ASSERT_EQ(zenith_get_stats(engine, &stats), ZENITH_OK);
+  EXPECT_EQ(stats.buffer_len, 0u);
+  EXPECT_EQ(stats.events_processed, 0u);
+
+  zenith_publish(engine, nullptr, nullptr, 0, 1);
+  zenith_publish(engine, nullptr, nullptr, 0, 2);
+
+  ASSERT_EQ(zenith_get_stats(engine, &stats), ZENITH_OK);
+  EXPECT_EQ(stats.buffer_len, 2u);
+  EXPECT_EQ(stats.events_processed, 2u);
+}
+
+TEST_F(CoreBackendTest, LatencyHistogramRecordsResidency) {
+  ZenithHistogram hist = {};
+  ASSERT_EQ(zenith_get_latency_histogram(engine, &hist), ZENITH_OK);
+  EXPECT_EQ(hist.total_events, 0u);
+  EXPECT_EQ(hist.min_ns, 0u);
+
+  for (int i = 0; i < 16; i++) {
+    ASSERT_EQ(zenith_publish(engine, nullptr, nullptr, 0, i), ZENITH_OK);
+  }
+  ZenithEvent event;
+  for (int i = 0; i < 16; i++) {
+    ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+  }
+
+  ASSERT_EQ(zenith_get_latency_histogram(engine, &hist), ZENITH_OK);
+  EXPECT_EQ(hist.total_events, 16u);
+  EXPECT_GE(hist.max_ns, hist.min_ns);
+
+  uint64_t bucket_sum = 0;
+  for (int i = 0; i < ZENITH_LATENCY_BUCKETS; i++) {
+    bucket_sum += hist.counts[i];
+  }
+  EXPECT_EQ(bucket_sum, 16u);
+}
+
+TEST_F(CoreBackendTest, LatencyHistogramResets) {
+  zenith_publish(engine, nullptr, nullptr, 0, 1);
+  ZenithEvent event;
+  zenith_consume(engine, &event);
+
+  ASSERT_EQ(zenith_reset_latency_histogram(engine), ZENITH_OK);
+  ZenithHistogram hist = {};
+  ASSERT_EQ(zenith_get_latency_histogram(engine, &hist), ZENITH_OK);
+  EXPECT_EQ(hist.total_events, 0u);
+  EXPECT_EQ(hist.max_ns, 0u);
+}
+
+TEST_F(CoreBackendTest, LatencyHistogramNullFails) {
+  EXPECT_EQ(zenith_get_latency_histogram(engine, nullptr),
+            ZENITH_ERR_NULL_PTR);
+  EXPECT_EQ(zenith_get_latency_histogram(nullptr, nullptr),
+            ZENITH_ERR_NULL_PTR);
+  EXPECT_EQ(zenith_reset_latency_histogram(nullptr), ZENITH_ERR_NULL_PTR);
+}
+
+TEST_F(CoreBackendTest, StatusReportsRunning) {
+  ZenithStatus status = {};
+  ASSERT_EQ(zenith_get_status(engine, &status), ZENITH_OK);
+  EXPECT_STREQ(status.status, "running");
+}
+
+// Plugin tests
+TEST_F(CoreBackendTest, LoadPluginValidatesHeader) {
+  const uint8_t wasm[] = {0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00};
+  EXPECT_EQ(zenith_load_plugin(engine, wasm, sizeof(wasm)), ZENITH_OK);
+
+  const uint8_t garbage[] = {0xde, 0xad, 0xbe, 0xef, 0, 0, 0, 0};
+  EXPECT_EQ(zenith_load_plugin(engine, garbage, sizeof(garbage)),
+            ZENITH_ERR_PLUGIN_LOAD);
+
+  ZenithStats stats = {};
+  zenith_get_stats(engine, &stats);
+  EXPECT_EQ(stats.plugin_count, 1u);
+}
+
+TEST_F(CoreBackendTest, PluginCacheMissThenHit) {
+  char dir[] = "/tmp/zenith_plugin_cache_XXXXXX";
+  ASSERT_NE(mkdtemp(dir), nullptr);
+
+  const uint8_t wasm[] = {0x00, 0x61, 0x73, 0x6d, 0x01, 0x00,
+                          0x00, 0x00, 0x42, 0x43, 0x44};
+
+  // Cold load validates and persists the artifact
+  ASSERT_EQ(zenith_load_plugin_cached(engine, wasm, sizeof(wasm), dir),
+            ZENITH_OK);
+
+  // A second engine gets a warm (mmap) load of the same module
+  ZenithEngine other = zenith_init(64);
+  ASSERT_NE(other, nullptr);
+  ASSERT_EQ(zenith_load_plugin_cached(other, wasm, sizeof(wasm), dir),
+            ZENITH_OK);
+  ZenithStats stats = {};
+  ASSERT_EQ(zenith_get_stats(other, &stats), ZENITH_OK);
+  EXPECT_EQ(stats.plugin_count, 1u);
+  zenith_free(other);
+
+  // Cleanup the cache directory
+  std::string cmd = std::string("rm -rf ") + dir;
+  system(cmd.c_str());
+}
+
+TEST_F(CoreBackendTest, PluginCacheNullDirBehavesLikePlainLoad) {
+  const uint8_t wasm[] = {0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00};
+  EXPECT_EQ(zenith_load_plugin_cached(engine, wasm, sizeof(wasm), nullptr),
+            ZENITH_OK);
+
+  const uint8_t garbage[] = {0xde, 0xad, 0xbe, 0xef, 0, 0, 0, 0};
+  char dir[] = "/tmp/zenith_plugin_cache_XXXXXX";
+  ASSERT_NE(mkdtemp(dir), nullptr);
+  EXPECT_EQ(zenith_load_plugin_cached(engine, garbage, sizeof(garbage), dir),
+            ZENITH_ERR_PLUGIN_LOAD);
+  std::string cmd = std::string("rm -rf ") + dir;
+  system(cmd.c_str());
+}
+
+// Shared-memory transport tests
+TEST(CoreShmTest, CreateAttachPublishConsume) {
+  const char *name = "/zenith_core_test_ring";
+  ZenithEngine creator = zenith_init_shm(name, 64);
+#if defined(__linux__)
+  ASSERT_NE(creator, nullptr);
+
+  ZenithEngine attached = zenith_attach_shm(name);
+  ASSERT_NE(attached, nullptr);
+
+  // Publish through the attached handle, consume through the creator
+  ASSERT_EQ(zenith_publish(attached, nullptr, nullptr, 9, 77), ZENITH_OK);
+  ZenithEvent event = {};
+  ASSERT_EQ(zenith_consume(creator, &event), ZENITH_OK);
+  EXPECT_EQ(event.source_id, 9u);
+  EXPECT_EQ(event.seq_no, 77u);
+
+  ZenithStats stats = {};
+  ASSERT_EQ(zenith_get_stats(attached, &stats), ZENITH_OK);
+  EXPECT_EQ(stats.events_processed, 1u);
+
+  zenith_free(attached);
+  zenith_free(creator); // unlinks the mapping
+  EXPECT_EQ(zenith_attach_shm(name), nullptr);
+#else
+  EXPECT_EQ(creator, nullptr);
+#endif
+}
+
+TEST(CoreShmTest, AttachMissingFails) {
+  EXPECT_EQ(zenith_attach_shm("/zenith_core_test_missing"), nullptr);
+  EXPECT_EQ(zenith_attach_shm(nullptr), nullptr);
+}
+
+// Per-node sharded engine tests. On single-node machines (and without
+// the NUMA backend) sharded init degrades to one ring, so these assert
+// the contract rather than a specific shard count.
+TEST(CoreShardTest, ShardedPublishConsumeRoundTrips) {
+  zenith_numa_init();
+  ZenithEngine engine = zenith_init_sharded(64, ZENITH_SHARD_BY_NODE);
+  ASSERT_NE(engine, nullptr);
+  EXPECT_GE(zenith_shard_count(engine), 1u);
+
+  for (uint64_t i = 0; i < 16; i++) {
+    ASSERT_EQ(zenith_publish(engine, nullptr, nullptr, 3, i), ZENITH_OK);
+  }
+
+  ZenithStats stats = {};
+  ASSERT_EQ(zenith_get_stats(engine, &stats), ZENITH_OK);
+  EXPECT_EQ(stats.events_processed, 16u);
+  EXPECT_EQ(stats.buffer_len, 16u);
+
+  // Every event comes back exactly once, in order within its shard
+  std::vector<bool> seen(16, false);
+  ZenithEvent event = {};
+  for (int i = 0; i < 16; i++) {
+    ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+    ASSERT_LT(event.seq_no, 16u);
+    EXPECT_FALSE(seen[event.seq_no]);
+    seen[event.seq_no] = true;
+  }
+  EXPECT_EQ(zenith_consume(engine, &event), ZENITH_ERR_BUFFER_EMPTY);
+
+  zenith_free(engine);
+}
+
+TEST(CoreShardTest, ShardedBatchAndHistogram) {
+  zenith_numa_init();
+  ZenithEngine engine = zenith_init_sharded(64, ZENITH_SHARD_BY_NODE);
+  ASSERT_NE(engine, nullptr);
+
+  std::vector<ZenithEvent> events(8);
+  for (size_t i = 0; i < events.size(); i++) {
+    events[i] = ZenithEvent{};
+    events[i].seq_no = i;
+  }
+  ASSERT_EQ(zenith_publish_batch(engine, events.data(), events.size()), 8);
+
+  ZenithEvent event = {};
+  for (int i = 0; i < 8; i++) {
+    ASSERT_EQ(zenith_consume(engine, &event), ZENITH_OK);
+  }
+
+  ZenithHistogram hist = {};
+  ASSERT_EQ(zenith_get_latency_histogram(engine, &hist), ZENITH_OK);
+  EXPECT_EQ(hist.total_events, 8u);
+
+  zenith_free(engine);
+}
+
+TEST(CoreShardTest, ShardedInitRejectsBadArgs) {
+  EXPECT_EQ(zenith_init_sharded(0, ZENITH_SHARD_BY_NODE), nullptr);
+  EXPECT_EQ(zenith_init_sharded(64, 0), nullptr);
+  EXPECT_EQ(zenith_shard_count(nullptr), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
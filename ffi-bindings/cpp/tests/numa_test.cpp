@@ -10,9 +10,29 @@
  *   ./numa_test
  */
 
+#include "../zenith_io.h"
+#include "../zenith_memops.h"
+#include "../zenith_prefetch.h"
+#include "../zenith_tasks.h"
+
+#include <atomic>
 #include "../zenith_numa.h"
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
 class NumaBackendTest : public ::testing::Test {
 protected:
   void SetUp() override {
@@ -119,6 +139,66 @@ TEST_F(NumaBackendTest, BindToInvalidNodeFails) {
   }
 }
 
+// Page migration tests
+TEST_F(NumaBackendTest, MigrateToSameNodeAccountsAllPages) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t size = 64 * 1024;
+    void *ptr = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(ptr, nullptr);
+
+    ZenithNumaMigrateStats stats = {};
+    EXPECT_EQ(zenith_numa_migrate_ex(ptr, size, 0, 1, &stats), ZENITH_NUMA_OK);
+    EXPECT_EQ(stats.pages_total, size / 4096);
+    EXPECT_EQ(stats.pages_moved + stats.pages_failed +
+                  stats.pages_already_on_node,
+              stats.pages_total);
+
+    zenith_numa_free(ptr, size);
+  }
+}
+
+TEST_F(NumaBackendTest, MigrateInvalidNodeFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    char buf[64];
+    EXPECT_EQ(zenith_numa_migrate(buf, sizeof(buf), 999),
+              ZENITH_NUMA_ERR_INVALID_NODE);
+    EXPECT_EQ(zenith_numa_migrate(nullptr, 4096, 0), ZENITH_NUMA_ERR_NULL_PTR);
+  }
+}
+
+// Bind plan tests
+TEST_F(NumaBackendTest, BindPlanPinsCallingThread) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithBindEntry plan[2];
+    plan[0].tid = 0; // calling thread
+    plan[0].cpu = 0;
+    plan[0].node = -1;
+    plan[1].tid = 0;
+    plan[1].cpu = -1; // rebind by node
+    plan[1].node = 0;
+
+    EXPECT_EQ(zenith_numa_apply_bind_plan(plan, 2), 2);
+    zenith_numa_unbind_thread();
+  }
+}
+
+TEST_F(NumaBackendTest, BindPlanSkipsInvalidEntries) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithBindEntry plan[2];
+    plan[0].tid = 0;
+    plan[0].cpu = 99999; // out of range: skipped
+    plan[0].node = -1;
+    plan[1].tid = 0;
+    plan[1].cpu = -1;
+    plan[1].node = 0;
+
+    EXPECT_EQ(zenith_numa_apply_bind_plan(plan, 2), 1);
+    EXPECT_EQ(zenith_numa_apply_bind_plan(nullptr, 1),
+              ZENITH_NUMA_ERR_NULL_PTR);
+    zenith_numa_unbind_thread();
+  }
+}
+
 // Node info tests
 TEST_F(NumaBackendTest, GetNodeInfoSucceeds) {
   if (init_result == ZENITH_NUMA_OK) {
@@ -138,6 +218,28 @@ TEST_F(NumaBackendTest, GetNodeInfoNullFails) {
   }
 }
 
+// Topology snapshot tests
+TEST_F(NumaBackendTest, TopologySnapshotMatchesQueries) {
+  if (init_result == ZENITH_NUMA_OK) {
+    static ZenithNumaTopology topo;
+    ASSERT_EQ(zenith_numa_get_topology(&topo), ZENITH_NUMA_OK);
+
+    EXPECT_EQ(topo.num_nodes, zenith_numa_num_nodes());
+    EXPECT_EQ(topo.num_cpus, zenith_numa_num_cpus());
+    for (int cpu = 0; cpu < topo.num_cpus && cpu < 4; cpu++) {
+      EXPECT_EQ(topo.cpu_to_node[cpu], zenith_numa_node_of_cpu(cpu));
+    }
+    EXPECT_EQ(topo.distance[0], zenith_numa_distance(0, 0));
+    EXPECT_EQ(topo.nodes[0].node_id, 0);
+  }
+}
+
+TEST_F(NumaBackendTest, TopologyNullFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_get_topology(nullptr), ZENITH_NUMA_ERR_NULL_PTR);
+  }
+}
+
 // Distance tests
 TEST_F(NumaBackendTest, DistanceToSelfIsMinimal) {
   if (init_result == ZENITH_NUMA_OK) {
@@ -147,6 +249,957 @@ TEST_F(NumaBackendTest, DistanceToSelfIsMinimal) {
   }
 }
 
+// Allocation flags / first-touch tests
+TEST_F(NumaBackendTest, AllocNoTouchSucceeds) {
+  if (init_result == ZENITH_NUMA_OK) {
+    void *ptr =
+        zenith_numa_alloc_onnode_ex(4096, 0, ZENITH_NUMA_ALLOC_NO_TOUCH);
+    EXPECT_NE(ptr, nullptr);
+    if (ptr) {
+      zenith_numa_free(ptr, 4096);
+    }
+  }
+}
+
+TEST_F(NumaBackendTest, LargeAllocIsZeroed) {
+  if (init_result == ZENITH_NUMA_OK) {
+    // Large enough to exercise the parallel first-touch path
+    const size_t size = 16u << 20;
+    uint8_t *ptr = static_cast<uint8_t *>(zenith_numa_alloc_onnode(size, 0));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(ptr[0], 0);
+    EXPECT_EQ(ptr[size / 2], 0);
+    EXPECT_EQ(ptr[size - 1], 0);
+    zenith_numa_free(ptr, size);
+  }
+}
+
+// Huge page tests
+TEST_F(NumaBackendTest, AllocHugeSucceedsWithFallback) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t size = 4u << 20;
+    void *ptr = zenith_numa_alloc_onnode_huge(size, 0, ZENITH_NUMA_PAGE_2MB);
+    ASSERT_NE(ptr, nullptr);
+
+    size_t page_size = zenith_numa_get_page_size(ptr);
+    // Either real 2 MB hugetlb pages or the base-page THP fallback
+    EXPECT_TRUE(page_size == ZENITH_NUMA_PAGE_2MB || page_size == 4096u);
+
+    zenith_numa_free(ptr, size);
+  }
+}
+
+TEST_F(NumaBackendTest, AllocHugeInvalidPageSizeFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_alloc_onnode_huge(4096, 0, 12345), nullptr);
+  }
+}
+
+TEST_F(NumaBackendTest, PageSizeOfRegularAllocIsBase) {
+  if (init_result == ZENITH_NUMA_OK) {
+    void *ptr = zenith_numa_alloc_onnode(4096, 0);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(zenith_numa_get_page_size(ptr), 4096u);
+    zenith_numa_free(ptr, 4096);
+  }
+}
+
+// Pooled allocation tests
+TEST_F(NumaBackendTest, PoolCreateAndDestroy) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithNumaPool pool = zenith_numa_pool_create(0, 4096, 16);
+    ASSERT_NE(pool, nullptr);
+    zenith_numa_pool_destroy(pool);
+  }
+}
+
+TEST_F(NumaBackendTest, PoolAllocFreeRecycles) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithNumaPool pool = zenith_numa_pool_create(0, 4096, 4);
+    ASSERT_NE(pool, nullptr);
+
+    void *first = zenith_numa_pool_alloc(pool);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(zenith_numa_pool_free(pool, first), ZENITH_NUMA_OK);
+
+    // LIFO freelist should hand the same buffer back
+    void *second = zenith_numa_pool_alloc(pool);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(zenith_numa_pool_free(pool, second), ZENITH_NUMA_OK);
+
+    zenith_numa_pool_destroy(pool);
+  }
+}
+
+TEST_F(NumaBackendTest, PoolExhaustionFallsBack) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithNumaPool pool = zenith_numa_pool_create(0, 256, 2);
+    ASSERT_NE(pool, nullptr);
+
+    void *a = zenith_numa_pool_alloc(pool);
+    void *b = zenith_numa_pool_alloc(pool);
+    void *c = zenith_numa_pool_alloc(pool); // beyond capacity
+    EXPECT_NE(a, nullptr);
+    EXPECT_NE(b, nullptr);
+    EXPECT_NE(c, nullptr);
+
+    EXPECT_EQ(zenith_numa_pool_free(pool, c), ZENITH_NUMA_OK);
+    EXPECT_EQ(zenith_numa_pool_free(pool, b), ZENITH_NUMA_OK);
+    EXPECT_EQ(zenith_numa_pool_free(pool, a), ZENITH_NUMA_OK);
+
+    zenith_numa_pool_destroy(pool);
+  }
+}
+
+TEST_F(NumaBackendTest, PoolCreateInvalidArgsFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_pool_create(0, 0, 16), nullptr);
+    EXPECT_EQ(zenith_numa_pool_create(0, 4096, 0), nullptr);
+    EXPECT_EQ(zenith_numa_pool_create(999, 4096, 16), nullptr);
+  }
+}
+
+// Batched allocation tests
+TEST_F(NumaBackendTest, AllocBatchCarvesContiguousSlab) {
+  if (init_result == ZENITH_NUMA_OK) {
+    void *bufs[8] = {};
+    ASSERT_EQ(zenith_numa_alloc_batch(1024, 0, 8, bufs), ZENITH_NUMA_OK);
+
+    for (int i = 0; i < 8; i++) {
+      ASSERT_NE(bufs[i], nullptr);
+    }
+    // Consecutive buffers come from one contiguous mapping
+    ptrdiff_t stride = static_cast<uint8_t *>(bufs[1]) -
+                       static_cast<uint8_t *>(bufs[0]);
+    EXPECT_EQ(stride, 1024);
+
+    EXPECT_EQ(zenith_numa_free_batch(bufs, 1024, 8), ZENITH_NUMA_OK);
+  }
+}
+
+TEST_F(NumaBackendTest, FreeBatchHandlesNonBatchPointers) {
+  if (init_result == ZENITH_NUMA_OK) {
+    void *bufs[2];
+    bufs[0] = zenith_numa_alloc_onnode(4096, 0);
+    bufs[1] = zenith_numa_alloc_onnode(4096, 0);
+    ASSERT_NE(bufs[0], nullptr);
+    ASSERT_NE(bufs[1], nullptr);
+    EXPECT_EQ(zenith_numa_free_batch(bufs, 4096, 2), ZENITH_NUMA_OK);
+  }
+}
+
+TEST_F(NumaBackendTest, AllocBatchNullOutFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_alloc_batch(1024, 0, 8, nullptr),
+              ZENITH_NUMA_ERR_NULL_PTR);
+  }
+}
+
+// Arena allocation tests
+TEST_F(NumaBackendTest, ArenaAllocBumpsSequentially) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithArena arena = zenith_arena_create(0, 64 * 1024);
+    ASSERT_NE(arena, nullptr);
+
+    uint8_t *a = static_cast<uint8_t *>(zenith_arena_alloc(arena, 100));
+    uint8_t *b = static_cast<uint8_t *>(zenith_arena_alloc(arena, 100));
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(b - a, 112); // 100 rounded up to 16-byte alignment
+
+    zenith_arena_destroy(arena);
+  }
+}
+
+TEST_F(NumaBackendTest, ArenaResetReusesMemory) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithArena arena = zenith_arena_create(0, 4096);
+    ASSERT_NE(arena, nullptr);
+
+    void *first = zenith_arena_alloc(arena, 256);
+    zenith_arena_reset(arena);
+    void *second = zenith_arena_alloc(arena, 256);
+    EXPECT_EQ(first, second);
+
+    zenith_arena_destroy(arena);
+  }
+}
+
+TEST_F(NumaBackendTest, ArenaGrowsBeyondChunk) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ZenithArena arena = zenith_arena_create(0, 4096);
+    ASSERT_NE(arena, nullptr);
+
+    // Exceeds the chunk size: arena must grow with a dedicated chunk
+    void *big = zenith_arena_alloc(arena, 16 * 1024);
+    EXPECT_NE(big, nullptr);
+    void *small = zenith_arena_alloc(arena, 64);
+    EXPECT_NE(small, nullptr);
+
+    zenith_arena_destroy(arena);
+  }
+}
+
+// Allocator statistics tests
+TEST_F(NumaBackendTest, StatsTrackAllocAndFree) {
+  if (init_result == ZENITH_NUMA_OK) {
+    zenith_numa_reset_stats();
+
+    void *ptr = zenith_numa_alloc_onnode(8192, 0);
+    ASSERT_NE(ptr, nullptr);
+
+    ZenithNumaStats stats = {};
+    ASSERT_EQ(zenith_numa_get_stats(&stats), ZENITH_NUMA_OK);
+    EXPECT_EQ(stats.nodes[0].alloc_count, 1u);
+    EXPECT_EQ(stats.nodes[0].bytes_allocated, 8192u);
+    EXPECT_EQ(stats.bytes_outstanding, 8192u);
+
+    // One latency sample must have landed in some bucket
+    uint64_t hist_total = 0;
+    for (int i = 0; i < ZENITH_NUMA_HIST_BUCKETS; i++) {
+      hist_total += stats.alloc_latency_hist[i];
+    }
+    EXPECT_EQ(hist_total, 1u);
+
+    zenith_numa_free(ptr, 8192);
+    ASSERT_EQ(zenith_numa_get_stats(&stats), ZENITH_NUMA_OK);
+    EXPECT_EQ(stats.free_count, 1u);
+    EXPECT_EQ(stats.bytes_outstanding, 0u);
+  }
+}
+
+TEST_F(NumaBackendTest, StatsTrackBindCalls) {
+  if (init_result == ZENITH_NUMA_OK) {
+    zenith_numa_reset_stats();
+    zenith_numa_bind_thread_to_node(0);
+    zenith_numa_unbind_thread();
+
+    ZenithNumaStats stats = {};
+    ASSERT_EQ(zenith_numa_get_stats(&stats), ZENITH_NUMA_OK);
+    EXPECT_EQ(stats.bind_calls, 1u);
+  }
+}
+
+TEST_F(NumaBackendTest, StatsNullFails) {
+  EXPECT_EQ(zenith_numa_get_stats(nullptr), ZENITH_NUMA_ERR_NULL_PTR);
+}
+
+TEST_F(NumaBackendTest, RecycleReusesFreedBuffer) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_numa_set_recycle(1, 0), ZENITH_NUMA_OK);
+
+    const size_t size = 1 << 20;
+    void *first = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(first, nullptr);
+    zenith_numa_free(first, size);
+
+    // Same node and size should come back from the recycle cache
+    void *second = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second, first);
+
+    // Recycled buffers are still first-touched back to zero
+    for (size_t i = 0; i < size; i += 4096) {
+      ASSERT_EQ(static_cast<uint8_t *>(second)[i], 0);
+    }
+
+    zenith_numa_free(second, size);
+    ASSERT_EQ(zenith_numa_set_recycle(0, 0), ZENITH_NUMA_OK);
+  }
+}
+
+TEST_F(NumaBackendTest, RecycleFlushDropsCachedBuffers) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_numa_set_recycle(1, 0), ZENITH_NUMA_OK);
+
+    const size_t size = 1 << 20;
+    void *first = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(first, nullptr);
+    zenith_numa_free(first, size);
+    zenith_numa_recycle_flush();
+
+    // The cache is empty, so this is a fresh mapping that must be freed
+    void *second = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(second, nullptr);
+    zenith_numa_free(second, size);
+    ASSERT_EQ(zenith_numa_set_recycle(0, 0), ZENITH_NUMA_OK);
+  }
+}
+
+TEST_F(NumaBackendTest, IoReadOnnodeRoundTrip) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_io_init(0), ZENITH_IO_OK);
+
+    char path[] = "/tmp/zenith_io_test_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    std::vector<uint8_t> data(256 * 1024);
+    for (size_t i = 0; i < data.size(); i++) {
+      data[i] = static_cast<uint8_t>(i * 13);
+    }
+    ASSERT_EQ(write(fd, data.data(), data.size()),
+              static_cast<ssize_t>(data.size()));
+
+    int64_t got = 0;
+    void *buf = zenith_io_read_onnode(fd, 0, data.size(), 0, &got);
+    ASSERT_NE(buf, nullptr);
+    EXPECT_EQ(got, static_cast<int64_t>(data.size()));
+    EXPECT_EQ(memcmp(buf, data.data(), data.size()), 0);
+    zenith_numa_free(buf, data.size());
+
+    // Offset read past part of the file is short at EOF
+    got = 0;
+    buf = zenith_io_read_onnode(fd, data.size() - 4096, 64 * 1024, 0, &got);
+    ASSERT_NE(buf, nullptr);
+    EXPECT_EQ(got, 4096);
+    EXPECT_EQ(memcmp(buf, data.data() + data.size() - 4096, 4096), 0);
+    zenith_numa_free(buf, 64 * 1024);
+
+    close(fd);
+    unlink(path);
+    zenith_io_cleanup();
+  }
+}
+
+TEST_F(NumaBackendTest, IoMultiChunkReadShortAtEOF) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_io_init(0), ZENITH_IO_OK);
+
+    // File smaller than one 1 MB chunk, request spanning several chunks:
+    // with multiple chunks in flight the ones past EOF complete with 0
+    // bytes and must not inflate the result (io_uring engine regression)
+    char path[] = "/tmp/zenith_io_eof_test_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const size_t file_size = 512 * 1024;
+    const size_t request = 4u << 20;
+    std::vector<uint8_t> data(file_size);
+    for (size_t i = 0; i < data.size(); i++) {
+      data[i] = static_cast<uint8_t>(i * 31);
+    }
+    ASSERT_EQ(write(fd, data.data(), data.size()),
+              static_cast<ssize_t>(data.size()));
+
+    int64_t got = 0;
+    void *buf = zenith_io_read_onnode(fd, 0, request, 0, &got);
+    ASSERT_NE(buf, nullptr);
+    EXPECT_EQ(got, static_cast<int64_t>(file_size));
+    EXPECT_EQ(memcmp(buf, data.data(), file_size), 0);
+    zenith_numa_free(buf, request);
+
+    close(fd);
+    unlink(path);
+    zenith_io_cleanup();
+  }
+}
+
+TEST_F(NumaBackendTest, IoInvalidArgsFail) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_io_init(0), ZENITH_IO_OK);
+    EXPECT_EQ(zenith_io_read_onnode(-1, 0, 4096, 0, nullptr), nullptr);
+    uint8_t scratch[16];
+    EXPECT_EQ(zenith_io_read_into(0, 0, nullptr, 16),
+              ZENITH_IO_ERR_INVALID_ARG);
+    EXPECT_EQ(zenith_io_read_into(-1, 0, scratch, 16),
+              ZENITH_IO_ERR_INVALID_ARG);
+    zenith_io_cleanup();
+  }
+}
+
+TEST_F(NumaBackendTest, MmapFileBindAndPrefault) {
+  if (init_result == ZENITH_NUMA_OK) {
+    char path[] = "/tmp/zenith_mmap_test_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    std::vector<uint8_t> data(128 * 1024);
+    for (size_t i = 0; i < data.size(); i++) {
+      data[i] = static_cast<uint8_t>(i * 7);
+    }
+    ASSERT_EQ(write(fd, data.data(), data.size()),
+              static_cast<ssize_t>(data.size()));
+
+    void *map = zenith_numa_mmap_file(
+        fd, 0, data.size(), ZENITH_NUMA_MMAP_BIND | ZENITH_NUMA_MMAP_PREFAULT,
+        1u << 0);
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(memcmp(map, data.data(), data.size()), 0);
+    EXPECT_EQ(zenith_numa_munmap_file(map, data.size()), ZENITH_NUMA_OK);
+
+    // Interleave across all nodes (mask 0 = all)
+    map = zenith_numa_mmap_file(fd, 0, data.size(),
+                                ZENITH_NUMA_MMAP_INTERLEAVE, 0);
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(memcmp(map, data.data(), data.size()), 0);
+    EXPECT_EQ(zenith_numa_munmap_file(map, data.size()), ZENITH_NUMA_OK);
+
+    close(fd);
+    unlink(path);
+  }
+}
+
+TEST_F(NumaBackendTest, MmapFileInvalidArgsFail) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_mmap_file(-1, 0, 4096, ZENITH_NUMA_MMAP_DEFAULT, 0),
+              nullptr);
+    // Unaligned offset is rejected
+    char path[] = "/tmp/zenith_mmap_test_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(
+        zenith_numa_mmap_file(fd, 123, 4096, ZENITH_NUMA_MMAP_DEFAULT, 0),
+        nullptr);
+    close(fd);
+    unlink(path);
+    EXPECT_EQ(zenith_numa_munmap_file(nullptr, 4096),
+              ZENITH_NUMA_ERR_NULL_PTR);
+  }
+}
+
+TEST_F(NumaBackendTest, PinnedAllocIsTrackedAndFreed) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t size = 64 * 1024;
+    void *ptr = zenith_numa_alloc_pinned(size, 0);
+    if (ptr == nullptr) {
+      GTEST_SKIP() << "mlock not permitted (RLIMIT_MEMLOCK)";
+    }
+
+    EXPECT_EQ(zenith_numa_is_pinned(ptr), 1);
+    memset(ptr, 0x42, size);
+    zenith_numa_free(ptr, size);
+    EXPECT_EQ(zenith_numa_is_pinned(ptr), 0);
+  }
+}
+
+TEST_F(NumaBackendTest, PinnedZeroSizeFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_alloc_pinned(0, 0), nullptr);
+    EXPECT_EQ(zenith_numa_is_pinned(nullptr), 0);
+  }
+}
+
+TEST_F(NumaBackendTest, ReallocGrowPreservesContents) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t old_size = 1 << 20;
+    const size_t new_size = 4 << 20;
+    uint8_t *buf =
+        static_cast<uint8_t *>(zenith_numa_alloc_onnode(old_size, 0));
+    ASSERT_NE(buf, nullptr);
+    for (size_t i = 0; i < old_size; i += 4096) {
+      buf[i] = static_cast<uint8_t>(i >> 12);
+    }
+
+    uint8_t *grown =
+        static_cast<uint8_t *>(zenith_numa_realloc(buf, old_size, new_size));
+    ASSERT_NE(grown, nullptr);
+    for (size_t i = 0; i < old_size; i += 4096) {
+      ASSERT_EQ(grown[i], static_cast<uint8_t>(i >> 12));
+    }
+    // The new tail is zeroed by the first touch
+    for (size_t i = old_size; i < new_size; i += 4096) {
+      ASSERT_EQ(grown[i], 0);
+    }
+    zenith_numa_free(grown, new_size);
+  }
+}
+
+TEST_F(NumaBackendTest, ReallocShrinkKeepsHead) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t old_size = 2 << 20;
+    const size_t new_size = 1 << 20;
+    uint8_t *buf =
+        static_cast<uint8_t *>(zenith_numa_alloc_onnode(old_size, 0));
+    ASSERT_NE(buf, nullptr);
+    memset(buf, 0x5C, old_size);
+
+    uint8_t *shrunk =
+        static_cast<uint8_t *>(zenith_numa_realloc(buf, old_size, new_size));
+    ASSERT_NE(shrunk, nullptr);
+    for (size_t i = 0; i < new_size; i += 4096) {
+      ASSERT_EQ(shrunk[i], 0x5C);
+    }
+    zenith_numa_free(shrunk, new_size);
+  }
+}
+
+TEST_F(NumaBackendTest, ReallocNullFails) {
+  EXPECT_EQ(zenith_numa_realloc(nullptr, 4096, 8192), nullptr);
+}
+
+TEST_F(NumaBackendTest, PrewarmProducesTakeableBuffers) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t size = 256 * 1024;
+    ASSERT_EQ(zenith_numa_prewarm(0, size, 4), ZENITH_NUMA_OK);
+
+    // Wait for the background worker to fill the ready list
+    void *ptr = nullptr;
+    for (int spin = 0; spin < 1000 && ptr == nullptr; spin++) {
+      ptr = zenith_numa_take_prewarmed(size, 0);
+      if (ptr == nullptr) {
+        usleep(1000);
+      }
+    }
+    ASSERT_NE(ptr, nullptr);
+
+    // Pre-warmed buffers are already zeroed by the first touch
+    for (size_t i = 0; i < size; i += 4096) {
+      ASSERT_EQ(static_cast<uint8_t *>(ptr)[i], 0);
+    }
+    zenith_numa_free(ptr, size);
+  }
+}
+
+TEST_F(NumaBackendTest, PrewarmMissReturnsNull) {
+  if (init_result == ZENITH_NUMA_OK) {
+    // Nothing was pre-warmed at this size
+    EXPECT_EQ(zenith_numa_take_prewarmed(977, 0), nullptr);
+    EXPECT_EQ(zenith_numa_prewarmed_count(977, 0), 0u);
+  }
+}
+
+TEST_F(NumaBackendTest, PrewarmInvalidNodeFails) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_numa_prewarm(-1, 4096, 1), ZENITH_NUMA_ERR_INVALID_NODE);
+    EXPECT_EQ(zenith_numa_prewarm(ZENITH_NUMA_MAX_NODES, 4096, 1),
+              ZENITH_NUMA_ERR_INVALID_NODE);
+  }
+}
+
+TEST_F(NumaBackendTest, SizedAllocRoundTrip) {
+  if (init_result == ZENITH_NUMA_OK) {
+    void *small = zenith_numa_alloc_4k_onnode(0);
+    void *image = zenith_numa_alloc_2m_onnode(0);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(image, nullptr);
+
+    // Both classes honor the zeroed-memory contract
+    for (size_t i = 0; i < 4096; i += 512) {
+      ASSERT_EQ(static_cast<uint8_t *>(small)[i], 0);
+    }
+    for (size_t i = 0; i < (2u << 20); i += 4096) {
+      ASSERT_EQ(static_cast<uint8_t *>(image)[i], 0);
+    }
+
+    zenith_numa_free_4k(small, 0);
+    zenith_numa_free_2m(image, 0);
+  }
+}
+
+TEST_F(NumaBackendTest, SizedAllocReusesThreadCache) {
+  if (init_result == ZENITH_NUMA_OK) {
+    void *first = zenith_numa_alloc_4k_onnode(0);
+    ASSERT_NE(first, nullptr);
+    memset(first, 0xAB, 4096);
+    zenith_numa_free_4k(first, 0);
+
+    // The cached block comes back to the same thread, scrubbed to zero
+    void *second = zenith_numa_alloc_4k_onnode(0);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second, first);
+    for (size_t i = 0; i < 4096; i += 512) {
+      ASSERT_EQ(static_cast<uint8_t *>(second)[i], 0);
+    }
+    zenith_numa_free_4k(second, 0);
+  }
+}
+
+TEST_F(NumaBackendTest, SizedFreeNullIsNoop) {
+  if (init_result == ZENITH_NUMA_OK) {
+    zenith_numa_free_4k(nullptr, 0);
+    zenith_numa_free_2m(nullptr, 0);
+    zenith_numa_free_16m(nullptr, 0);
+  }
+}
+
+TEST_F(NumaBackendTest, TierRegisterScanUnregister) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_tier_configure(0, 10, 1), ZENITH_NUMA_OK);
+
+    const size_t size = 1 << 20;
+    void *buf = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(buf, nullptr);
+    ASSERT_EQ(zenith_tier_register(buf, size), ZENITH_NUMA_OK);
+
+    ZenithTierStats stats = {};
+    ASSERT_EQ(zenith_tier_get_stats(&stats), ZENITH_NUMA_OK);
+    EXPECT_EQ(stats.regions_tracked, 1u);
+
+    // Let the sampler complete at least one pass
+    for (int spin = 0; spin < 1000; spin++) {
+      zenith_tier_get_stats(&stats);
+      if (stats.scans_completed > 0) {
+        break;
+      }
+      usleep(1000);
+    }
+    EXPECT_GT(stats.scans_completed, 0u);
+
+    // The buffer stays readable regardless of which tier it is on
+    EXPECT_EQ(static_cast<uint8_t *>(buf)[0], 0);
+
+    EXPECT_EQ(zenith_tier_unregister(buf), ZENITH_NUMA_OK);
+    zenith_tier_stop();
+    zenith_numa_free(buf, size);
+  }
+}
+
+TEST_F(NumaBackendTest, TierInvalidArgsFail) {
+  if (init_result == ZENITH_NUMA_OK) {
+    EXPECT_EQ(zenith_tier_configure(-1, 0, 0), ZENITH_NUMA_ERR_INVALID_NODE);
+    EXPECT_EQ(zenith_tier_register(nullptr, 4096), ZENITH_NUMA_ERR_NULL_PTR);
+    EXPECT_EQ(zenith_tier_unregister(nullptr), ZENITH_NUMA_ERR_NULL_PTR);
+    EXPECT_EQ(zenith_tier_get_stats(nullptr), ZENITH_NUMA_ERR_NULL_PTR);
+  }
+}
+
+TEST_F(NumaBackendTest, MonitorCachesNodeMemory) {
+  if (init_result == ZENITH_NUMA_OK) {
+    ASSERT_EQ(zenith_numa_monitor_start(10), ZENITH_NUMA_OK);
+
+    // Wait for the first refresh
+    uint64_t total = 0;
+    for (int spin = 0; spin < 1000 && total == 0; spin++) {
+      total = zenith_numa_node_total_cached(0);
+      if (total == 0) {
+        usleep(1000);
+      }
+    }
+    EXPECT_GT(total, 0u);
+    EXPECT_LE(zenith_numa_node_free_cached(0), total);
+
+    // Snapshot matches what the uncached query reports, roughly
+    ZenithNumaNodeInfo info = {};
+    ASSERT_EQ(zenith_numa_get_node_info(0, &info), ZENITH_NUMA_OK);
+    EXPECT_EQ(total, info.total_memory);
+
+    zenith_numa_monitor_stop();
+    // Snapshot survives the stop
+    EXPECT_EQ(zenith_numa_node_total_cached(0), total);
+  }
+}
+
+TEST_F(NumaBackendTest, MonitorPressureCallbackValidation) {
+  if (init_result == ZENITH_NUMA_OK) {
+    // A 100% watermark would fire immediately; 101 is invalid
+    EXPECT_NE(zenith_numa_set_pressure_callback(nullptr, nullptr, 101),
+              ZENITH_NUMA_OK);
+    EXPECT_EQ(zenith_numa_set_pressure_callback(nullptr, nullptr, 10),
+              ZENITH_NUMA_OK);
+  }
+}
+
+TEST_F(NumaBackendTest, MonitorOutOfRangeNodeReadsZero) {
+  EXPECT_EQ(zenith_numa_node_free_cached(-1), 0u);
+  EXPECT_EQ(zenith_numa_node_free_cached(ZENITH_NUMA_MAX_NODES), 0u);
+}
+
+namespace {
+std::atomic<int> g_task_counter{0};
+void count_task(void *arg) {
+  g_task_counter.fetch_add(arg != nullptr ? *static_cast<int *>(arg) : 1);
+}
+} // namespace
+
+TEST_F(NumaBackendTest, TaskPoolRunsSubmittedWork) {
+  ZenithTaskPool pool = zenith_pool_create(2);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_GT(zenith_pool_num_workers(pool), 0);
+
+  g_task_counter = 0;
+  int weight = 3;
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(zenith_pool_submit(pool, count_task, &weight, 0),
+              ZENITH_POOL_OK);
+  }
+  ASSERT_EQ(zenith_pool_wait(pool), ZENITH_POOL_OK);
+  EXPECT_EQ(g_task_counter.load(), 300);
+
+  zenith_pool_destroy(pool);
+}
+
+TEST_F(NumaBackendTest, TaskPoolRoundRobinSubmit) {
+  ZenithTaskPool pool = zenith_pool_create(1);
+  ASSERT_NE(pool, nullptr);
+
+  g_task_counter = 0;
+  for (int i = 0; i < 32; i++) {
+    ASSERT_EQ(zenith_pool_submit(pool, count_task, nullptr, -1),
+              ZENITH_POOL_OK);
+  }
+  // Destroy drains the queues before joining the workers
+  zenith_pool_destroy(pool);
+  EXPECT_EQ(g_task_counter.load(), 32);
+}
+
+TEST_F(NumaBackendTest, TaskPoolInvalidArgsFail) {
+  EXPECT_EQ(zenith_pool_submit(nullptr, count_task, nullptr, 0),
+            ZENITH_POOL_ERR_INVALID_ARG);
+  EXPECT_EQ(zenith_pool_wait(nullptr), ZENITH_POOL_ERR_INVALID_ARG);
+  EXPECT_EQ(zenith_pool_num_workers(nullptr), 0);
+
+  ZenithTaskPool pool = zenith_pool_create(1);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(zenith_pool_submit(pool, nullptr, nullptr, 0),
+            ZENITH_POOL_ERR_INVALID_ARG);
+  zenith_pool_destroy(pool);
+}
+
+TEST(PrefetchTest, PlanCoalescesAdjacentRanges) {
+  std::vector<uint8_t> buf(64 * 4096);
+  uint8_t *base = buf.data();
+
+  // Three ranges inside the same pages plus one far away: two batches
+  ZenithPrefetchRange ranges[] = {
+      {base, 4096},
+      {base + 4096, 4096},
+      {base + 2048, 8192},
+      {base + 48 * 4096, 4096},
+  };
+  int32_t issued = zenith_prefetch_plan(ranges, 4);
+  EXPECT_EQ(issued, 2);
+}
+
+TEST(PrefetchTest, PlanHandlesDegenerateInput) {
+  EXPECT_EQ(zenith_prefetch_plan(nullptr, 3), -1);
+
+  ZenithPrefetchRange empty[] = {{nullptr, 4096}, {&empty, 0}};
+  EXPECT_EQ(zenith_prefetch_plan(empty, 2), 0);
+  EXPECT_EQ(zenith_prefetch_plan(empty, 0), 0);
+}
+
+TEST(PrefetchTest, PrefetchLinesIsSafe) {
+  // Purely a hint; just verify it doesn't fault across a range
+  std::vector<uint8_t> buf(16 * 1024, 1);
+  zenith_prefetch_lines(buf.data(), buf.size());
+  zenith_prefetch_lines(buf.data(), 1);
+  SUCCEED();
+}
+
+TEST(IoEngineTest, EngineIsReported) {
+  const char *engine = zenith_io_engine();
+  ASSERT_NE(engine, nullptr);
+  EXPECT_TRUE(strcmp(engine, "io_uring") == 0 || strcmp(engine, "pread") == 0);
+}
+
+TEST_F(NumaBackendTest, RecycleDisabledFreesNormally) {
+  if (init_result == ZENITH_NUMA_OK) {
+    const size_t size = 64 * 1024;
+    void *ptr = zenith_numa_alloc_onnode(size, 0);
+    ASSERT_NE(ptr, nullptr);
+    zenith_numa_free(ptr, size);
+  }
+}
+
+// Memory ops tests (no NUMA dependency)
+TEST(MemOpsTest, IsaIsReported) {
+  const char *isa = zenith_memops_isa();
+  ASSERT_NE(isa, nullptr);
+  EXPECT_TRUE(strcmp(isa, "avx512") == 0 || strcmp(isa, "avx2") == 0 ||
+              strcmp(isa, "scalar") == 0);
+}
+
+TEST(MemOpsTest, StreamCopyMatchesMemcpy) {
+  // Odd size and offset exercise the unaligned head/tail paths
+  const size_t size = 1 << 20;
+  std::vector<uint8_t> src(size + 7), dst(size + 7, 0);
+  for (size_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i * 31);
+  }
+
+  zenith_memcpy_stream(dst.data() + 3, src.data() + 1, size);
+  EXPECT_EQ(memcmp(dst.data() + 3, src.data() + 1, size), 0);
+}
+
+TEST(MemOpsTest, StreamFillSetsEveryByte) {
+  const size_t size = 123457;
+  std::vector<uint8_t> buf(size, 0);
+  zenith_memset_stream(buf.data() + 1, 0xAB, size - 1);
+  for (size_t i = 1; i < size; i++) {
+    ASSERT_EQ(buf[i], 0xAB);
+  }
+  EXPECT_EQ(buf[0], 0);
+}
+
+TEST(MemOpsTest, GatherCopyStridedFloats) {
+  // Gather channel 0 from interleaved 3-channel float data
+  const size_t count = 1000;
+  std::vector<float> src(count * 3);
+  for (size_t i = 0; i < count; i++) {
+    src[i * 3] = static_cast<float>(i);
+  }
+
+  std::vector<float> dst(count, -1.0f);
+  zenith_gather_copy(dst.data(), src.data(), sizeof(float), count,
+                     3 * sizeof(float));
+  for (size_t i = 0; i < count; i++) {
+    ASSERT_EQ(dst[i], static_cast<float>(i));
+  }
+}
+
+TEST(MemOpsTest, GatherCopyOddElementSize) {
+  const size_t count = 100;
+  std::vector<uint8_t> src(count * 7);
+  for (size_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i);
+  }
+
+  std::vector<uint8_t> dst(count * 3, 0);
+  zenith_gather_copy(dst.data(), src.data(), 3, count, 7);
+  for (size_t i = 0; i < count; i++) {
+    ASSERT_EQ(memcmp(dst.data() + i * 3, src.data() + i * 7, 3), 0);
+  }
+}
+
+// ============================================================================
+// Performance-regression gate (opt-in)
+//
+// Timed assertions over the hot backend operations, so a change that
+// makes them drastically slower fails the gate instead of sailing
+// through the correctness tests. Enabled by ZENITH_PERF_GATE=1 (the
+// ctest target numa_perf_gate sets it); skipped otherwise so the
+// default unit-test run carries no timing flakiness. The first gated
+// run calibrates a per-machine baseline file (ZENITH_PERF_BASELINE,
+// default zenith_perf_baseline.txt in the working directory); later
+// runs fail when an operation exceeds baseline * ZENITH_PERF_TOLERANCE
+// (default 3x, generous on purpose - this catches 10x accidents, not
+// 10% drift). Baselines are tightened whenever a run measures faster.
+// ============================================================================
+
+namespace perf_gate {
+
+inline uint64_t cycles_now() {
+#if defined(__x86_64__)
+  return __rdtsc();
+#else
+  // Fall back to nanoseconds; baseline and measurement share the unit
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull +
+         static_cast<uint64_t>(ts.tv_nsec);
+#endif
+}
+
+inline std::string baseline_path() {
+  const char *env = getenv("ZENITH_PERF_BASELINE");
+  return env != nullptr ? env : "zenith_perf_baseline.txt";
+}
+
+inline std::map<std::string, uint64_t> load_baselines() {
+  std::map<std::string, uint64_t> baselines;
+  std::ifstream in(baseline_path());
+  std::string name;
+  uint64_t cycles;
+  while (in >> name >> cycles) {
+    baselines[name] = cycles;
+  }
+  return baselines;
+}
+
+inline void store_baselines(const std::map<std::string, uint64_t> &baselines) {
+  std::ofstream out(baseline_path(), std::ios::trunc);
+  for (const auto &entry : baselines) {
+    out << entry.first << " " << entry.second << "\n";
+  }
+}
+
+inline double tolerance() {
+  const char *env = getenv("ZENITH_PERF_TOLERANCE");
+  double tol = env != nullptr ? atof(env) : 0.0;
+  return tol > 1.0 ? tol : 3.0;
+}
+
+// Best-of-N: the minimum is the least noisy estimator of an
+// operation's true cost under scheduler jitter
+template <typename Fn> uint64_t best_cycles(Fn &&fn, int iters) {
+  uint64_t best = UINT64_MAX;
+  for (int i = 0; i < iters; i++) {
+    uint64_t t0 = cycles_now();
+    fn();
+    uint64_t dt = cycles_now() - t0;
+    if (dt < best) {
+      best = dt;
+    }
+  }
+  return best;
+}
+
+// Compare against the calibrated baseline, recording it on first run
+inline void assert_budget(const std::string &name, uint64_t measured) {
+  std::map<std::string, uint64_t> baselines = load_baselines();
+  auto it = baselines.find(name);
+  if (it == baselines.end()) {
+    baselines[name] = measured;
+    store_baselines(baselines);
+    std::cout << "[perf-gate] " << name << ": baseline calibrated at "
+              << measured << " cycles\n";
+    return;
+  }
+
+  double tol = tolerance();
+  uint64_t budget = static_cast<uint64_t>(it->second * tol);
+  EXPECT_LE(measured, budget)
+      << "performance regression in " << name << ": " << measured
+      << " cycles vs baseline " << it->second << " (budget " << budget
+      << " = baseline * " << tol << "; recalibrate by deleting "
+      << baseline_path() << " if the change is intentional)";
+  if (measured < it->second) {
+    baselines[name] = measured;
+    store_baselines(baselines);
+  }
+}
+
+} // namespace perf_gate
+
+class NumaPerfGate : public ::testing::Test {
+protected:
+  void SetUp() override {
+    if (getenv("ZENITH_PERF_GATE") == nullptr) {
+      GTEST_SKIP() << "set ZENITH_PERF_GATE=1 to run timing assertions";
+    }
+    if (zenith_numa_init() != ZENITH_NUMA_OK) {
+      GTEST_SKIP() << "NUMA unavailable";
+    }
+  }
+
+  void TearDown() override { zenith_numa_cleanup(); }
+};
+
+TEST_F(NumaPerfGate, AllocFreeOnnode) {
+  uint64_t best = perf_gate::best_cycles(
+      [] {
+        void *ptr = zenith_numa_alloc_onnode(1 << 20, 0);
+        ASSERT_NE(ptr, nullptr);
+        zenith_numa_free(ptr, 1 << 20);
+      },
+      64);
+  perf_gate::assert_budget("alloc_free_onnode_1m", best);
+}
+
+TEST_F(NumaPerfGate, ThreadBindUnbind) {
+  uint64_t best = perf_gate::best_cycles(
+      [] {
+        ASSERT_EQ(zenith_numa_bind_thread_to_node(0), ZENITH_NUMA_OK);
+        ASSERT_EQ(zenith_numa_unbind_thread(), ZENITH_NUMA_OK);
+      },
+      64);
+  perf_gate::assert_budget("thread_bind_unbind", best);
+}
+
+TEST_F(NumaPerfGate, SizedAllocFastPath) {
+  // Warm the thread cache so this measures the steady-state reuse path
+  void *warm = zenith_numa_alloc_4k_onnode(0);
+  ASSERT_NE(warm, nullptr);
+  zenith_numa_free_4k(warm, 0);
+
+  uint64_t best = perf_gate::best_cycles(
+      [] {
+        void *ptr = zenith_numa_alloc_4k_onnode(0);
+        ASSERT_NE(ptr, nullptr);
+        zenith_numa_free_4k(ptr, 0);
+      },
+      256);
+  perf_gate::assert_budget("sized_alloc_4k_fast_path", best);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -17,11 +17,64 @@ typedef void* ZenithEngine;
 #define ZENITH_ERR_BUFFER_FULL -2
 #define ZENITH_ERR_PLUGIN_LOAD -3
 #define ZENITH_ERR_FFI -4
+#define ZENITH_ERR_BUFFER_EMPTY -5
 
 // Engine lifecycle
+// buffer_size is rounded up to the next power of two
 ZenithEngine zenith_init(uint32_t buffer_size);
 void zenith_free(ZenithEngine engine);
 
+// Shared-memory transport: create the event ring inside a named POSIX
+// shared-memory mapping so co-located producer processes can publish
+// with zero copies and zero syscalls on the hot path. The creator owns
+// the mapping; zenith_free unlinks it. Pointer fields in events are
+// transported verbatim, so cross-process producers should pass offsets
+// into a shared payload region. zenith_publish_owned is in-process only
+// and must not be used on an shm engine.
+ZenithEngine zenith_init_shm(const char* name, uint32_t buffer_size);
+
+// Attach to an existing shared-memory ring created by zenith_init_shm.
+// The returned engine publishes and consumes the same ring; release it
+// with zenith_free (attachers unmap without unlinking).
+ZenithEngine zenith_attach_shm(const char* name);
+
+// Shard routing mode for zenith_init_sharded
+#define ZENITH_SHARD_BY_NODE 1
+
+// Per-node event sharding: create one ring of buffer_size slots per
+// NUMA node, with cursors and slots in node-local memory. Producers
+// publish into the ring of the node they are running on, so the slot
+// claim never bounces cache lines across sockets and publish throughput
+// scales with socket count; consumers drain their local shard first,
+// then sweep the remote shards. FIFO ordering holds within a shard, not
+// across shards — order-sensitive consumers should sort on seq_no.
+// Requires the NUMA backend to be initialized (zenith_numa_init);
+// degrades to a plain single-ring engine on single-node machines or
+// when NUMA is unavailable. Release with zenith_free.
+ZenithEngine zenith_init_sharded(uint32_t buffer_size, int32_t shard_mode);
+
+// Number of rings backing an engine: one per NUMA node for sharded
+// engines, 1 otherwise, 0 for a NULL handle.
+size_t zenith_shard_count(ZenithEngine engine);
+
+// Event record as stored in the ring
+typedef struct {
+    void* array_ptr;    // Arrow C data interface array
+    void* schema_ptr;   // Arrow C data interface schema
+    uint32_t source_id;
+    uint64_t seq_no;
+    void* owner;        // refcount handle for owned events, NULL otherwise
+} ZenithEvent;
+
+// Release callback for zenith_publish_owned: invoked once, after the last
+// reference to the event is dropped, typically forwarding to the Arrow
+// release mechanism.
+typedef void (*ZenithReleaseFn)(
+    void* array_ptr,
+    void* schema_ptr,
+    void* user_data
+);
+
 // Event publishing
 int32_t zenith_publish(
     ZenithEngine engine,
@@ -31,6 +84,45 @@ int32_t zenith_publish(
     uint64_t seq_no
 );
 
+// Publish with ownership transfer instead of a payload copy.
+// The engine holds a reference to the payload and invokes `release` after
+// the last consumer drops its reference, so 64 KB - 4 MB Arrow batches are
+// never memcpy'd through the ring. Consumers receive one reference from
+// zenith_consume and must drop it with zenith_event_release.
+int32_t zenith_publish_owned(
+    ZenithEngine engine,
+    void* array_ptr,
+    void* schema_ptr,
+    uint32_t source_id,
+    uint64_t seq_no,
+    ZenithReleaseFn release,
+    void* user_data
+);
+
+// Take an additional reference on a consumed event, e.g. before handing it
+// to another consumer. No-op for events published without ownership.
+void zenith_event_retain(ZenithEvent* event);
+
+// Drop a reference on a consumed event; the release callback fires when
+// the last reference goes away. No-op for non-owned events.
+void zenith_event_release(ZenithEvent* event);
+
+// Publish a batch of events with one ring reservation.
+// All slots for the batch are claimed with a single atomic update instead
+// of one head CAS per event, then filled and committed in order. When the
+// ring cannot hold the whole batch a prefix is published.
+// Returns the number of events published (0 when the ring is full, so
+// backpressure still works), or a negative error code.
+int32_t zenith_publish_batch(
+    ZenithEngine engine,
+    const ZenithEvent* events,
+    size_t count
+);
+
+// Pop the oldest event from the ring.
+// Returns ZENITH_ERR_BUFFER_EMPTY when no event is pending.
+int32_t zenith_consume(ZenithEngine engine, ZenithEvent* out);
+
 // Plugin management
 int32_t zenith_load_plugin(
     ZenithEngine engine,
@@ -38,6 +130,24 @@ int32_t zenith_load_plugin(
     size_t len
 );
 
+// Load a plugin through the content-addressed ahead-of-time cache.
+//
+// The wasm bytes are hashed together with the module format version; on
+// a warm cache the prepared module artifact under cache_dir is mapped
+// back in and registered directly, skipping validation and preparation
+// entirely, so a restart with a long transform chain loads in
+// milliseconds. On a miss the module goes through the normal load path
+// and the prepared artifact is persisted (written to a temp file and
+// renamed, so a crashed writer never publishes a torn artifact).
+// cache_dir is created if missing; passing NULL disables the disk cache
+// and behaves exactly like zenith_load_plugin.
+int32_t zenith_load_plugin_cached(
+    ZenithEngine engine,
+    const uint8_t* wasm_bytes,
+    size_t len,
+    const char* cache_dir
+);
+
 // Engine statistics
 typedef struct {
     size_t buffer_len;
@@ -47,6 +157,28 @@ typedef struct {
 
 int32_t zenith_get_stats(ZenithEngine engine, ZenithStats* stats);
 
+// Ring residency latency histogram. Bucket i counts events whose
+// publish-to-consume time fell in [2^i, 2^(i+1)) nanoseconds. Recording
+// is always on: one monotonic timestamp pair and a relaxed increment
+// per event.
+#define ZENITH_LATENCY_BUCKETS 32
+
+typedef struct {
+    uint64_t counts[ZENITH_LATENCY_BUCKETS];
+    uint64_t total_events;
+    uint64_t min_ns;  // 0 when no events were recorded
+    uint64_t max_ns;
+} ZenithHistogram;
+
+// Snapshot the engine's latency histogram. For shared-memory engines
+// residency is measured by whichever process consumes, so each
+// attachment sees the latency of its own consumption.
+int32_t zenith_get_latency_histogram(ZenithEngine engine,
+                                     ZenithHistogram* hist);
+
+// Zero the engine's latency histogram.
+int32_t zenith_reset_latency_histogram(ZenithEngine engine);
+
 // Admin API status
 typedef struct {
     const char* status;
@@ -0,0 +1,71 @@
+/**
+ * Zenith Memory Ops - C FFI Header
+ *
+ * Runtime-dispatched SIMD bulk memory kernels for tensor staging: cache-
+ * bypassing (non-temporal) streaming copy and fill, plus a strided
+ * gather-copy for layout shuffles. The best implementation for the host
+ * CPU (AVX-512, AVX2, or scalar) is selected once into a function-pointer
+ * table, so the hot path has no dispatch overhead.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZENITH_MEMOPS_H
+#define ZENITH_MEMOPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Copy memory with non-temporal (streaming) stores.
+ * Bypasses the cache hierarchy on the store side, so bulk staging copies
+ * do not evict the working set from the LLC. Stores are fenced before
+ * returning.
+ *
+ * @param dst Destination buffer
+ * @param src Source buffer (must not overlap dst)
+ * @param size Size in bytes
+ */
+void zenith_memcpy_stream(void *dst, const void *src, size_t size);
+
+/**
+ * Fill memory with non-temporal (streaming) stores.
+ *
+ * @param dst Destination buffer
+ * @param value Byte value to fill with
+ * @param size Size in bytes
+ */
+void zenith_memset_stream(void *dst, uint8_t value, size_t size);
+
+/**
+ * Gather strided elements into a contiguous buffer.
+ * Copies `count` elements of `elem_size` bytes, reading them `src_stride`
+ * bytes apart and writing them densely - the inner loop of NHWC->NCHW
+ * style layout shuffles.
+ *
+ * @param dst Destination buffer (count * elem_size bytes, contiguous)
+ * @param src First source element
+ * @param elem_size Element size in bytes
+ * @param count Number of elements
+ * @param src_stride Distance in bytes between consecutive source elements
+ */
+void zenith_gather_copy(void *dst, const void *src, size_t elem_size,
+                        size_t count, size_t src_stride);
+
+/**
+ * Report which instruction set the kernels were dispatched to.
+ *
+ * @return "avx512", "avx2", or "scalar"
+ */
+const char *zenith_memops_isa(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENITH_MEMOPS_H */
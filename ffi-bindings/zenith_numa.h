@@ -92,6 +92,11 @@ int32_t zenith_numa_preferred_node(void);
  * ============================================================================
  */
 
+/* Allocation flags */
+#define ZENITH_NUMA_ALLOC_DEFAULT 0u
+/* Skip the first-touch pass; for callers that write the buffer immediately */
+#define ZENITH_NUMA_ALLOC_NO_TOUCH (1u << 0)
+
 /**
  * Allocate memory on a specific NUMA node.
  *
@@ -101,6 +106,18 @@ int32_t zenith_numa_preferred_node(void);
  */
 void *zenith_numa_alloc_onnode(size_t size, int32_t node);
 
+/**
+ * Allocate memory on a specific NUMA node with allocation flags.
+ * Large buffers are first-touched by a thread team pinned to the node
+ * unless ZENITH_NUMA_ALLOC_NO_TOUCH is set.
+ *
+ * @param size Size in bytes to allocate
+ * @param node NUMA node ID
+ * @param flags ZENITH_NUMA_ALLOC_* flags
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_onnode_ex(size_t size, int32_t node, uint32_t flags);
+
 /**
  * Allocate memory interleaved across all NUMA nodes.
  * Useful for data accessed by threads on different nodes.
@@ -110,6 +127,15 @@ void *zenith_numa_alloc_onnode(size_t size, int32_t node);
  */
 void *zenith_numa_alloc_interleaved(size_t size);
 
+/**
+ * Allocate interleaved memory with allocation flags.
+ *
+ * @param size Size in bytes to allocate
+ * @param flags ZENITH_NUMA_ALLOC_* flags
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_interleaved_ex(size_t size, uint32_t flags);
+
 /**
  * Allocate memory on the local NUMA node.
  * Memory is allocated on the node closest to the calling thread.
@@ -119,6 +145,71 @@ void *zenith_numa_alloc_interleaved(size_t size);
  */
 void *zenith_numa_alloc_local(size_t size);
 
+/**
+ * Allocate local-node memory with allocation flags.
+ *
+ * @param size Size in bytes to allocate
+ * @param flags ZENITH_NUMA_ALLOC_* flags
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_local_ex(size_t size, uint32_t flags);
+
+/* Huge page sizes for zenith_numa_alloc_onnode_huge */
+#define ZENITH_NUMA_PAGE_2MB (2ull << 20)
+#define ZENITH_NUMA_PAGE_1GB (1ull << 30)
+
+/**
+ * Allocate node-bound memory backed by huge pages.
+ * Tries explicit hugetlb pages of the requested size first; 1 GB requests
+ * degrade to 2 MB if unavailable, and the final fallback is base pages
+ * with a transparent-huge-page hint. Use zenith_numa_get_page_size to see
+ * which page size was actually obtained. Free with zenith_numa_free.
+ *
+ * @param size Size in bytes to allocate (rounded up to the page size)
+ * @param node NUMA node ID
+ * @param page_size ZENITH_NUMA_PAGE_2MB or ZENITH_NUMA_PAGE_1GB
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_onnode_huge(size_t size, int32_t node,
+                                    size_t page_size);
+
+/**
+ * Report the page size backing an allocation.
+ * For huge allocations this is the page size actually obtained (the base
+ * page size when the allocation fell back to transparent huge pages).
+ *
+ * @param ptr Pointer returned by a zenith_numa_alloc_* function
+ * @return Page size in bytes, or 0 for NULL
+ */
+size_t zenith_numa_get_page_size(const void *ptr);
+
+/**
+ * Allocate page-locked node-bound memory for DMA staging.
+ *
+ * The buffer is allocated on `node`, first-touched, and mlock'd so its
+ * pages can never be swapped or migrated under a device transfer. When
+ * the backend is built with CUDA support the buffer is additionally
+ * host-registered (cudaHostRegister), making it a valid
+ * cudaMemcpyAsync source/target - the same buffer can be the disk-read
+ * destination and the GPU upload source with no intermediate copy.
+ * Free with zenith_numa_free; unlocking and deregistration happen
+ * automatically.
+ *
+ * @param size Size in bytes to allocate
+ * @param node NUMA node ID
+ * @return Pointer to pinned memory, or NULL on failure (including when
+ *         RLIMIT_MEMLOCK would be exceeded)
+ */
+void *zenith_numa_alloc_pinned(size_t size, int32_t node);
+
+/**
+ * Check whether a buffer came from zenith_numa_alloc_pinned.
+ *
+ * @param ptr Pointer returned by a zenith_numa_alloc_* function
+ * @return 1 if pinned, 0 otherwise
+ */
+int32_t zenith_numa_is_pinned(const void *ptr);
+
 /**
  * Free NUMA-allocated memory.
  *
@@ -127,6 +218,281 @@ void *zenith_numa_alloc_local(size_t size);
  */
 void zenith_numa_free(void *ptr, size_t size);
 
+/**
+ * Resize a NUMA allocation in place where possible.
+ *
+ * Growth is performed with mremap(), so extending a buffer is a
+ * page-table operation with no data copy; already-faulted pages keep
+ * their node placement and the mapping's memory policy carries over to
+ * the new tail, which is first-touched on the buffer's node. Only when
+ * the kernel cannot remap does this fall back to allocate-copy-free.
+ * Not for huge-page, pool, arena, or batch allocations.
+ *
+ * @param ptr Buffer from zenith_numa_alloc_onnode/local/interleaved
+ * @param old_size Current size of the allocation
+ * @param new_size Requested size
+ * @return Resized buffer (possibly at a new address) to release with
+ *         zenith_numa_free(ptr, new_size), or NULL on failure (the
+ *         original buffer is untouched)
+ */
+void *zenith_numa_realloc(void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * Enable or disable deferred reclaim for zenith_numa_free.
+ *
+ * When enabled, freed buffers are marked MADV_FREE and parked on a
+ * per-node cache instead of being unmapped immediately, avoiding the
+ * munmap TLB shootdown on the free path. Subsequent same-node
+ * allocations of the same size reuse cached buffers without a new
+ * mmap+mbind. A background trimmer returns cached buffers to the kernel
+ * when a node's free memory runs low, and the per-node byte budget
+ * bounds the cache. Disabling flushes all cached buffers.
+ *
+ * @param enabled 1 to enable deferred reclaim, 0 to disable
+ * @param max_bytes_per_node Cache budget per node in bytes (0 keeps the
+ *                           current budget; default 256 MB)
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_set_recycle(int32_t enabled, uint64_t max_bytes_per_node);
+
+/**
+ * Unmap every buffer held in the recycle cache immediately.
+ * Safe to call whether or not deferred reclaim is enabled.
+ */
+void zenith_numa_recycle_flush(void);
+
+/**
+ * Allocate a batch of equally-sized node-bound buffers in one call.
+ * The buffers are carved from a single contiguous mapping, so one FFI
+ * crossing and one mmap+mbind pair covers the whole set.
+ *
+ * @param size Size in bytes of each buffer (rounded up to a cache line)
+ * @param node NUMA node ID
+ * @param count Number of buffers to allocate
+ * @param out Array of `count` slots to receive the buffer pointers
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_alloc_batch(size_t size, int32_t node, uint32_t count,
+                                void **out);
+
+/**
+ * Free a batch of buffers in one call.
+ * Batch-allocated buffers release their backing slab once every buffer
+ * carved from it has been returned; other pointers are passed through to
+ * zenith_numa_free.
+ *
+ * @param ptrs Array of `count` buffer pointers (NULL entries are skipped)
+ * @param size Size passed at allocation time (used for non-batch pointers)
+ * @param count Number of entries in `ptrs`
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_free_batch(void **ptrs, size_t size, uint32_t count);
+
+/* ============================================================================
+ * Pooled Allocation
+ * ============================================================================
+ */
+
+/* Opaque pool handle */
+typedef void *ZenithNumaPool;
+
+/**
+ * Create a per-node pool of fixed-size buffers.
+ * The pool allocates one node-bound slab up front and recycles buffers
+ * through a lock-free freelist, avoiding per-allocation syscalls.
+ *
+ * @param size_class Buffer size in bytes (rounded up to a cache line)
+ * @param node NUMA node ID the slab is bound to
+ * @param capacity Number of buffers held by the pool
+ * @return Pool handle, or NULL on failure
+ */
+ZenithNumaPool zenith_numa_pool_create(int32_t node, size_t size_class,
+                                       uint32_t capacity);
+
+/**
+ * Allocate one buffer from the pool.
+ * Steady-state this is a lock-free freelist pop with zero syscalls. If the
+ * pool is exhausted it falls back to a direct node-bound allocation.
+ *
+ * @param pool Pool handle
+ * @return Pointer to a size_class-sized buffer, or NULL on failure
+ */
+void *zenith_numa_pool_alloc(ZenithNumaPool pool);
+
+/**
+ * Return a buffer to the pool.
+ * Accepts both pooled buffers and fallback allocations made when the pool
+ * was exhausted.
+ *
+ * @param pool Pool handle
+ * @param ptr Buffer previously returned by zenith_numa_pool_alloc
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_pool_free(ZenithNumaPool pool, void *ptr);
+
+/**
+ * Destroy a pool and release its slab.
+ * All buffers allocated from the pool become invalid.
+ *
+ * @param pool Pool handle
+ */
+void zenith_numa_pool_destroy(ZenithNumaPool pool);
+
+/* ============================================================================
+ * Arena Allocation
+ * ============================================================================
+ */
+
+/* Opaque arena handle */
+typedef void *ZenithArena;
+
+/**
+ * Create a NUMA-local bump-pointer arena.
+ * Intended for short-lived variable-size scratch allocations made by a
+ * single (typically node-pinned) worker thread; the arena itself is not
+ * thread-safe.
+ *
+ * @param node NUMA node ID for arena chunks, or -1 for the local node
+ * @param chunk_size Size in bytes of each node-bound chunk
+ * @return Arena handle, or NULL on failure
+ */
+ZenithArena zenith_arena_create(int32_t node, size_t chunk_size);
+
+/**
+ * Allocate scratch memory from the arena.
+ * A pointer bump with no atomics or syscalls on the hot path; the arena
+ * grows by whole chunks when exhausted. Individual allocations cannot be
+ * freed - use zenith_arena_reset.
+ *
+ * @param arena Arena handle
+ * @param size Size in bytes (rounded up to 16-byte alignment)
+ * @return Pointer to scratch memory, or NULL on failure
+ */
+void *zenith_arena_alloc(ZenithArena arena, size_t size);
+
+/**
+ * Reset the arena, invalidating all allocations made from it.
+ * Chunks are retained for reuse, so per-batch reset costs no syscalls.
+ *
+ * @param arena Arena handle
+ */
+void zenith_arena_reset(ZenithArena arena);
+
+/**
+ * Destroy the arena and release its chunks.
+ *
+ * @param arena Arena handle
+ */
+void zenith_arena_destroy(ZenithArena arena);
+
+/* ============================================================================
+ * Allocation Pre-Warming
+ * ============================================================================
+ */
+
+/**
+ * Enqueue background allocation of node-bound buffers.
+ *
+ * A worker thread pinned to `node` allocates and first-touches `count`
+ * buffers of `size` bytes ahead of demand, so the mmap + mbind + memset
+ * cost is paid off the batch critical path. Pre-warmed buffers are
+ * handed out by zenith_numa_take_prewarmed; buffers still queued at
+ * cleanup are released.
+ *
+ * @param node NUMA node ID
+ * @param size Size of each buffer in bytes
+ * @param count Number of buffers to prepare
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_prewarm(int32_t node, size_t size, size_t count);
+
+/**
+ * Take one pre-warmed buffer, if available.
+ * A hit is a list pop with no syscalls and no page faults - the buffer
+ * is already placed and touched. Returns NULL on a miss (nothing
+ * pre-warmed for this size and node yet); callers fall back to
+ * zenith_numa_alloc_onnode.
+ *
+ * @param size Size requested from zenith_numa_prewarm
+ * @param node NUMA node ID
+ * @return Buffer to release with zenith_numa_free(ptr, size), or NULL
+ */
+void *zenith_numa_take_prewarmed(size_t size, int32_t node);
+
+/**
+ * Number of pre-warmed buffers currently ready on a node.
+ *
+ * @param size Size requested from zenith_numa_prewarm
+ * @param node NUMA node ID
+ * @return Count of ready buffers
+ */
+size_t zenith_numa_prewarmed_count(size_t size, int32_t node);
+
+/* ============================================================================
+ * Size-Specialized Fast Paths
+ * ============================================================================
+ *
+ * Shims over a templated C++ core (numa_sized.h) instantiated for the
+ * three allocation sizes production traffic is dominated by: 4 KB
+ * control blocks, 2 MB image buffers, and 16 MB shard chunks. Backing
+ * page size and touch strategy are resolved at compile time per size
+ * class, and each instantiation keeps a small per-thread freelist, so
+ * the steady-state path is branch-free with no size-class computation,
+ * no locks, and no syscalls. Returned memory is zeroed. Release with
+ * the matching free shim (preferred - refills the thread cache) or
+ * zenith_numa_free(ptr, size).
+ */
+
+/**
+ * Allocate a zeroed 4 KB control block on a node.
+ *
+ * @param node NUMA node ID
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_4k_onnode(int32_t node);
+
+/**
+ * Allocate a zeroed 2 MB buffer on a node, huge-page backed when
+ * available.
+ *
+ * @param node NUMA node ID
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_2m_onnode(int32_t node);
+
+/**
+ * Allocate a zeroed 16 MB shard chunk on a node, huge-page backed when
+ * available.
+ *
+ * @param node NUMA node ID
+ * @return Pointer to allocated memory, or NULL on failure
+ */
+void *zenith_numa_alloc_16m_onnode(int32_t node);
+
+/**
+ * Release a 4 KB block into the calling thread's fast-path cache.
+ *
+ * @param ptr Pointer from zenith_numa_alloc_4k_onnode
+ * @param node Node the block was allocated on
+ */
+void zenith_numa_free_4k(void *ptr, int32_t node);
+
+/**
+ * Release a 2 MB buffer into the calling thread's fast-path cache.
+ *
+ * @param ptr Pointer from zenith_numa_alloc_2m_onnode
+ * @param node Node the buffer was allocated on
+ */
+void zenith_numa_free_2m(void *ptr, int32_t node);
+
+/**
+ * Release a 16 MB chunk into the calling thread's fast-path cache.
+ *
+ * @param ptr Pointer from zenith_numa_alloc_16m_onnode
+ * @param node Node the chunk was allocated on
+ */
+void zenith_numa_free_16m(void *ptr, int32_t node);
+
 /* ============================================================================
  * Thread Binding
  * ============================================================================
@@ -155,6 +521,143 @@ int32_t zenith_numa_bind_thread_to_cpu(int32_t cpu);
  */
 int32_t zenith_numa_unbind_thread(void);
 
+/**
+ * One entry of a bulk thread-binding plan.
+ * A non-negative `cpu` pins to that CPU; otherwise `node` pins to the
+ * node's whole CPU set.
+ */
+typedef struct {
+  uint64_t tid; /**< pthread_t of the target thread, 0 = calling thread */
+  int32_t cpu;  /**< CPU to pin to, or -1 to bind by node */
+  int32_t node; /**< NUMA node to pin to when cpu is -1 */
+} ZenithBindEntry;
+
+/**
+ * Apply a whole thread-binding plan in one call.
+ * Uses the per-node CPU sets cached at zenith_numa_init, so rebinding a
+ * full worker set at an epoch boundary performs no allocations - one
+ * affinity syscall per entry. Entries with out-of-range CPUs or nodes
+ * are skipped.
+ *
+ * @param plan Array of bind entries
+ * @param n Number of entries
+ * @return Number of entries applied, or a negative error code
+ */
+int32_t zenith_numa_apply_bind_plan(const ZenithBindEntry *plan, size_t n);
+
+/* ============================================================================
+ * Page Migration
+ * ============================================================================
+ */
+
+/**
+ * Per-page outcome counts for a migration pass.
+ */
+typedef struct {
+  uint64_t pages_total;           /**< Pages covered by the request */
+  uint64_t pages_moved;           /**< Pages now resident on the target */
+  uint64_t pages_failed;          /**< Pages the kernel could not move */
+  uint64_t pages_already_on_node; /**< Pages that were already local */
+} ZenithNumaMigrateStats;
+
+/**
+ * Migrate a live buffer to another NUMA node in place.
+ * Built on batched move_pages(2); the buffer stays valid and mapped at
+ * the same address throughout.
+ *
+ * @param ptr Start of the region (rounded down to a page boundary)
+ * @param size Region size in bytes
+ * @param target_node Destination NUMA node ID
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_migrate(void *ptr, size_t size, int32_t target_node);
+
+/**
+ * Migrate with explicit thread count and per-page stats.
+ * num_threads 0 picks automatically: single-threaded for small regions,
+ * a thread team for regions of 64 MB and up.
+ *
+ * @param ptr Start of the region
+ * @param size Region size in bytes
+ * @param target_node Destination NUMA node ID
+ * @param num_threads Worker threads to use, or 0 for automatic
+ * @param stats Optional stats struct to fill (may be NULL)
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_migrate_ex(void *ptr, size_t size, int32_t target_node,
+                               uint32_t num_threads,
+                               ZenithNumaMigrateStats *stats);
+
+/* ============================================================================
+ * Hot/Cold Page Tiering
+ * ============================================================================
+ */
+
+/**
+ * Counters for the tiering engine.
+ */
+typedef struct {
+  uint64_t regions_tracked;  /**< Regions currently registered */
+  uint64_t bytes_demoted;    /**< Bytes moved to the capacity node */
+  uint64_t bytes_promoted;   /**< Bytes moved back to their home node */
+  uint64_t scans_completed;  /**< Sampler passes since configure */
+} ZenithTierStats;
+
+/**
+ * Configure and start the tiering engine.
+ *
+ * A sampler thread tracks access recency of registered regions with
+ * soft-dirty page tracking and migrates chunks between tiers: a chunk
+ * untouched for `cold_scans` consecutive scans is demoted to
+ * `capacity_node` (a far/capacity tier), and a demoted chunk that gets
+ * touched again is promoted back to its home node. This keeps
+ * local-node DRAM for the working set that actually determines batch
+ * latency. Note that soft-dirty tracking observes writes; read-mostly
+ * data that must stay local should not be registered.
+ *
+ * @param capacity_node Node that receives demoted chunks
+ * @param scan_interval_ms Sampler period in milliseconds (0 selects 1000)
+ * @param cold_scans Scans without a touch before demotion (0 selects 3)
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_tier_configure(int32_t capacity_node,
+                              uint32_t scan_interval_ms,
+                              uint32_t cold_scans);
+
+/**
+ * Stop the tiering engine. Demoted chunks stay where they are;
+ * registered regions are forgotten.
+ */
+void zenith_tier_stop(void);
+
+/**
+ * Register a region for tiering. The region's current node becomes its
+ * home (promotion target). The buffer must stay mapped until
+ * unregistered.
+ *
+ * @param ptr Start of the region (page-aligned allocations expected)
+ * @param size Region size in bytes
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_tier_register(void *ptr, size_t size);
+
+/**
+ * Remove a region from tiering. Pages are left on whatever node they
+ * currently occupy.
+ *
+ * @param ptr Pointer previously passed to zenith_tier_register
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_tier_unregister(void *ptr);
+
+/**
+ * Snapshot the tiering counters.
+ *
+ * @param stats Struct to fill
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_tier_get_stats(ZenithTierStats *stats);
+
 /* ============================================================================
  * Memory Policies
  * ============================================================================
@@ -184,6 +687,118 @@ int32_t zenith_numa_set_interleave(uint64_t nodemask);
  */
 int32_t zenith_numa_set_membind(uint64_t nodemask);
 
+/* ============================================================================
+ * File-Backed Mapping
+ * ============================================================================
+ */
+
+/* Placement policies for zenith_numa_mmap_file */
+#define ZENITH_NUMA_MMAP_DEFAULT 0    /* kernel default (first-touch) */
+#define ZENITH_NUMA_MMAP_BIND 1       /* pages only on nodemask nodes */
+#define ZENITH_NUMA_MMAP_INTERLEAVE 2 /* round-robin across nodemask */
+
+/* OR into the policy to fault every page in with a parallel thread team
+ * right after the policy is applied */
+#define ZENITH_NUMA_MMAP_PREFAULT 0x100
+
+/**
+ * Map a file range read-only with explicit NUMA placement.
+ *
+ * The range is mmap'd and the requested policy is applied with mbind()
+ * before any page is faulted, so file-backed memory gets the same
+ * placement control as zenith_numa_alloc_interleaved() gives anonymous
+ * memory - a large dataset shard no longer lands entirely on whichever
+ * node faulted it first. With ZENITH_NUMA_MMAP_PREFAULT the pages are
+ * faulted in immediately by a parallel read pass.
+ *
+ * @param fd Open file descriptor
+ * @param offset Byte offset into the file (must be page-aligned)
+ * @param len Length of the mapping in bytes
+ * @param policy ZENITH_NUMA_MMAP_* policy, optionally OR'd with
+ *               ZENITH_NUMA_MMAP_PREFAULT
+ * @param nodemask Bitmask of NUMA nodes (bit N = node N); ignored for
+ *                 ZENITH_NUMA_MMAP_DEFAULT, 0 means all nodes
+ * @return Mapped address to release with zenith_numa_munmap_file, or
+ *         NULL on failure
+ */
+void *zenith_numa_mmap_file(int32_t fd, uint64_t offset, size_t len,
+                            int32_t policy, uint64_t nodemask);
+
+/**
+ * Unmap a mapping created by zenith_numa_mmap_file.
+ *
+ * @param ptr Address returned by zenith_numa_mmap_file
+ * @param len Length passed to zenith_numa_mmap_file
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_munmap_file(void *ptr, size_t len);
+
+/* ============================================================================
+ * Memory-Pressure Monitoring
+ * ============================================================================
+ */
+
+/**
+ * Pressure watermark callback. Fired from the monitor thread when a
+ * node's free memory drops below the configured watermark, and once
+ * more (with below = 0) when it recovers. Keep it short; the monitor
+ * does not refresh while the callback runs.
+ */
+typedef void (*ZenithPressureFn)(int32_t node, uint64_t free_bytes,
+                                 uint64_t total_bytes, int32_t below,
+                                 void *user_data);
+
+/**
+ * Start the background memory monitor.
+ *
+ * A thread refreshes per-node total/free memory into an atomic snapshot
+ * every `interval_ms`, so admission checks read cached values with a
+ * single atomic load instead of a sysfs read per decision. Idempotent;
+ * a second call adjusts the interval.
+ *
+ * @param interval_ms Refresh period in milliseconds (0 selects 100 ms)
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_monitor_start(uint32_t interval_ms);
+
+/**
+ * Stop the background memory monitor. The last snapshot stays readable.
+ */
+void zenith_numa_monitor_stop(void);
+
+/**
+ * Free memory on a node from the monitor snapshot.
+ * A single atomic load; returns 0 before the first refresh.
+ *
+ * @param node NUMA node ID
+ * @return Free bytes at the last refresh
+ */
+uint64_t zenith_numa_node_free_cached(int32_t node);
+
+/**
+ * Total memory on a node from the monitor snapshot.
+ *
+ * @param node NUMA node ID
+ * @return Total bytes at the last refresh
+ */
+uint64_t zenith_numa_node_total_cached(int32_t node);
+
+/**
+ * Install a pressure watermark callback.
+ *
+ * The callback fires edge-triggered per node: once when free memory
+ * crosses below `watermark_pct` percent of total, once when it
+ * recovers above. Pass NULL to remove the callback.
+ *
+ * @param fn Callback, or NULL to clear
+ * @param user_data Opaque pointer forwarded to the callback
+ * @param watermark_pct Free-memory watermark as a percentage of total
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_set_pressure_callback(ZenithPressureFn fn,
+                                          void *user_data,
+                                          uint32_t watermark_pct);
+
 /* ============================================================================
  * Statistics and Information
  * ============================================================================
@@ -208,6 +823,73 @@ typedef struct {
  */
 int32_t zenith_numa_get_node_info(int32_t node, ZenithNumaNodeInfo *info);
 
+/* Fixed bounds for the flat topology snapshot */
+#define ZENITH_NUMA_MAX_NODES 64
+#define ZENITH_NUMA_MAX_CPUS 1024
+
+/* Log2-nanosecond latency histogram buckets: bucket i counts operations
+ * that took [2^i, 2^(i+1)) ns */
+#define ZENITH_NUMA_HIST_BUCKETS 32
+
+/**
+ * Per-node allocation counters.
+ */
+typedef struct {
+  uint64_t alloc_count;     /**< Allocations placed on this node */
+  uint64_t bytes_allocated; /**< Cumulative bytes placed on this node */
+} ZenithNumaNodeStats;
+
+/**
+ * Aggregated allocator statistics.
+ * Counters are recorded into thread-local blocks with relaxed atomics
+ * (cheap enough to leave on permanently) and summed on read.
+ */
+typedef struct {
+  ZenithNumaNodeStats nodes[ZENITH_NUMA_MAX_NODES]; /**< Per-node counters */
+  uint64_t free_count;        /**< Total frees */
+  uint64_t bytes_freed;       /**< Cumulative bytes freed */
+  uint64_t bytes_outstanding; /**< Allocated minus freed */
+  uint64_t bind_calls;        /**< Thread bind operations */
+  uint64_t alloc_latency_hist[ZENITH_NUMA_HIST_BUCKETS]; /**< Alloc latency */
+  uint64_t free_latency_hist[ZENITH_NUMA_HIST_BUCKETS];  /**< Free latency */
+} ZenithNumaStats;
+
+/**
+ * Aggregate allocator statistics across all threads.
+ *
+ * @param stats Pointer to struct to fill
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_get_stats(ZenithNumaStats *stats);
+
+/**
+ * Reset all allocator statistics to zero.
+ */
+void zenith_numa_reset_stats(void);
+
+/**
+ * Flat snapshot of the machine topology, built once at zenith_numa_init.
+ * The distance matrix is row-major: distance[n1 * ZENITH_NUMA_MAX_NODES + n2].
+ * free_memory in the per-node info reflects the state at init time.
+ */
+typedef struct {
+  int32_t num_nodes; /**< Configured NUMA nodes (capped at MAX_NODES) */
+  int32_t num_cpus;  /**< Configured CPUs (capped at MAX_CPUS) */
+  int32_t cpu_to_node[ZENITH_NUMA_MAX_CPUS]; /**< NUMA node per CPU */
+  ZenithNumaNodeInfo nodes[ZENITH_NUMA_MAX_NODES]; /**< Per-node info */
+  int32_t distance[ZENITH_NUMA_MAX_NODES *
+                   ZENITH_NUMA_MAX_NODES]; /**< NxN distance matrix */
+} ZenithNumaTopology;
+
+/**
+ * Copy the cached topology snapshot in a single call.
+ * Replaces per-CPU / per-node-pair query loops with one FFI round trip.
+ *
+ * @param topology Pointer to struct to fill
+ * @return ZENITH_NUMA_OK on success, error code on failure
+ */
+int32_t zenith_numa_get_topology(ZenithNumaTopology *topology);
+
 /**
  * Get the distance between two NUMA nodes.
  * Lower values indicate closer/faster access.
@@ -0,0 +1,92 @@
+/**
+ * Zenith Task Pool - C FFI Header
+ *
+ * NUMA-partitioned work-stealing thread pool. Workers are pinned to
+ * their node with the existing binding calls and drain their own node's
+ * queue first; an idle worker steals from other nodes in
+ * zenith_numa_distance() order, so tasks migrate to near nodes before
+ * far ones. Parallel native work (first-touch, migration, big copies)
+ * can share one pool instead of each growing its own threads.
+ *
+ * Copyright 2025 Zenith Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZENITH_TASKS_H
+#define ZENITH_TASKS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Error codes */
+#define ZENITH_POOL_OK 0
+#define ZENITH_POOL_ERR_INVALID_ARG -1
+#define ZENITH_POOL_ERR_ALLOC_FAILED -2
+
+/* Opaque pool handle */
+typedef void *ZenithTaskPool;
+
+/**
+ * Task entry point. `arg` is the pointer passed to zenith_pool_submit.
+ */
+typedef void (*ZenithTaskFn)(void *arg);
+
+/**
+ * Create a work-stealing pool with `threads_per_node` workers pinned to
+ * each NUMA node. On a machine without NUMA support this degrades to a
+ * single-node pool with unpinned workers.
+ *
+ * @param threads_per_node Workers per node (0 selects one per node CPU)
+ * @return Pool handle, or NULL on failure
+ */
+ZenithTaskPool zenith_pool_create(int32_t threads_per_node);
+
+/**
+ * Submit a task.
+ *
+ * The task is queued on `preferred_node` and normally runs on a worker
+ * pinned there; when that node's workers are saturated an idle worker
+ * from the nearest other node steals it.
+ *
+ * @param pool Pool handle
+ * @param fn Task entry point
+ * @param arg Opaque argument forwarded to `fn`
+ * @param preferred_node Target node, or -1 to round-robin across nodes
+ * @return ZENITH_POOL_OK on success, error code on failure
+ */
+int32_t zenith_pool_submit(ZenithTaskPool pool, ZenithTaskFn fn, void *arg,
+                           int32_t preferred_node);
+
+/**
+ * Block until every submitted task has finished.
+ *
+ * @param pool Pool handle
+ * @return ZENITH_POOL_OK on success, error code on failure
+ */
+int32_t zenith_pool_wait(ZenithTaskPool pool);
+
+/**
+ * Total number of worker threads in the pool.
+ *
+ * @param pool Pool handle
+ * @return Worker count, or 0 for NULL
+ */
+int32_t zenith_pool_num_workers(ZenithTaskPool pool);
+
+/**
+ * Destroy the pool. Waits for queued tasks to finish, then joins and
+ * releases the workers.
+ *
+ * @param pool Pool handle
+ */
+void zenith_pool_destroy(ZenithTaskPool pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENITH_TASKS_H */